@@ -0,0 +1,134 @@
+/* Generated by tools/asset_packer -t, do not edit.
+ * Polyphase interpolation filter for audio_irq(). */
+static const int16_t audio_taps[AUDIO_PHASES + 1][AUDIO_TAPS]
+    ONCHIP_RODATA = {
+    {     0,     0,     0,     0,     0,     0,     0, 16384,
+          0,     0,     0,     0,     0,     0,     0,     0},
+    {    -2,     7,   -15,    31,   -57,   106,  -241, 16376,
+        249,  -109,    58,   -31,    16,    -7,     3,     0},
+    {    -5,    14,   -31,    61,  -112,   210,  -474, 16357,
+        507,  -219,   117,   -63,    32,   -14,     5,    -1},
+    {    -7,    20,   -45,    90,  -167,   312,  -697, 16325,
+        772,  -332,   176,   -95,    48,   -22,     8,    -2},
+    {    -9,    26,   -59,   118,  -219,   410,  -912, 16276,
+       1045,  -446,   237,  -128,    65,   -29,    11,    -2},
+    {   -11,    32,   -73,   146,  -271,   506, -1118, 16217,
+       1326,  -562,   298,  -161,    82,   -37,    13,    -3},
+    {   -13,    38,   -86,   172,  -320,   598, -1315, 16144,
+       1613,  -679,   359,  -194,    99,   -45,    16,    -3},
+    {   -15,    43,   -99,   198,  -368,   687, -1502, 16057,
+       1907,  -796,   421,  -227,   116,   -53,    19,    -4},
+    {   -16,    49,  -111,   222,  -414,   772, -1680, 15957,
+       2208,  -914,   482,  -261,   134,   -61,    22,    -5},
+    {   -18,    53,  -123,   246,  -458,   854, -1849, 15847,
+       2514, -1033,   544,  -294,   151,   -69,    25,    -6},
+    {   -19,    58,  -134,   268,  -501,   932, -2008, 15721,
+       2827, -1151,   606,  -328,   168,   -77,    28,    -6},
+    {   -21,    62,  -144,   290,  -541,  1006, -2157, 15581,
+       3145, -1269,   667,  -361,   186,   -85,    32,    -7},
+    {   -22,    66,  -154,   310,  -579,  1076, -2297, 15434,
+       3467, -1387,   727,  -394,   203,   -93,    35,    -8},
+    {   -23,    70,  -163,   329,  -615,  1142, -2427, 15272,
+       3795, -1504,   787,  -427,   220,  -101,    38,    -9},
+    {   -24,    74,  -172,   347,  -649,  1204, -2547, 15097,
+       4127, -1620,   847,  -459,   237,  -109,    41,   -10},
+    {   -25,    77,  -180,   364,  -680,  1262, -2658, 14912,
+       4462, -1734,   905,  -491,   254,  -117,    44,   -11},
+    {   -26,    80,  -187,   379,  -709,  1315, -2759, 14715,
+       4801, -1846,   962,  -522,   270,  -125,    48,   -12},
+    {   -26,    82,  -194,   393,  -736,  1364, -2851, 14508,
+       5143, -1957,  1018,  -552,   286,  -133,    51,   -12},
+    {   -27,    85,  -200,   406,  -761,  1409, -2933, 14288,
+       5488, -2065,  1072,  -581,   302,  -140,    54,   -13},
+    {   -27,    87,  -205,   417,  -783,  1450, -3006, 14060,
+       5835, -2171,  1125,  -610,   317,  -148,    57,   -14},
+    {   -28,    88,  -210,   428,  -803,  1486, -3069, 13823,
+       6183, -2273,  1175,  -638,   332,  -155,    60,   -15},
+    {   -28,    90,  -214,   436,  -821,  1517, -3123, 13575,
+       6533, -2372,  1224,  -664,   346,  -162,    63,   -16},
+    {   -28,    91,  -217,   444,  -836,  1545, -3168, 13318,
+       6883, -2468,  1271,  -690,   359,  -169,    66,   -17},
+    {   -28,    92,  -220,   451,  -849,  1568, -3204, 13050,
+       7234, -2559,  1315,  -714,   372,  -175,    69,   -18},
+    {   -28,    92,  -222,   456,  -859,  1587, -3231, 12777,
+       7584, -2647,  1357,  -737,   385,  -182,    71,   -19},
+    {   -28,    93,  -223,   460,  -867,  1601, -3250, 12491,
+       7934, -2729,  1397,  -758,   396,  -187,    74,   -20},
+    {   -28,    93,  -224,   462,  -873,  1611, -3260, 12204,
+       8282, -2807,  1433,  -778,   407,  -193,    76,   -21},
+    {   -27,    92,  -225,   464,  -876,  1617, -3262, 11904,
+       8629, -2880,  1467,  -796,   417,  -198,    79,   -21},
+    {   -27,    92,  -224,   464,  -878,  1619, -3256, 11600,
+       8974, -2947,  1498,  -813,   426,  -203,    81,   -22},
+    {   -27,    91,  -223,   463,  -877,  1617, -3243, 11290,
+       9317, -3009,  1525,  -828,   435,  -207,    83,   -23},
+    {   -26,    90,  -222,   461,  -874,  1611, -3221, 10973,
+       9656, -3065,  1550,  -841,   442,  -211,    85,   -24},
+    {   -26,    89,  -220,   458,  -868,  1601, -3192, 10651,
+       9992, -3114,  1570,  -852,   448,  -215,    86,   -24},
+    {   -25,    88,  -218,   454,  -861,  1588, -3157, 10323,
+      10323, -3157,  1588,  -861,   454,  -218,    88,   -25},
+    {   -24,    86,  -215,   448,  -852,  1570, -3114,  9992,
+      10651, -3192,  1601,  -868,   458,  -220,    89,   -26},
+    {   -24,    85,  -211,   442,  -841,  1550, -3065,  9656,
+      10973, -3221,  1611,  -874,   461,  -222,    90,   -26},
+    {   -23,    83,  -207,   435,  -828,  1525, -3009,  9317,
+      11290, -3243,  1617,  -877,   463,  -223,    91,   -27},
+    {   -22,    81,  -203,   426,  -813,  1498, -2947,  8974,
+      11600, -3256,  1619,  -878,   464,  -224,    92,   -27},
+    {   -21,    79,  -198,   417,  -796,  1467, -2880,  8629,
+      11904, -3262,  1617,  -876,   464,  -225,    92,   -27},
+    {   -21,    76,  -193,   407,  -778,  1433, -2807,  8282,
+      12204, -3260,  1611,  -873,   462,  -224,    93,   -28},
+    {   -20,    74,  -187,   396,  -758,  1397, -2729,  7934,
+      12491, -3250,  1601,  -867,   460,  -223,    93,   -28},
+    {   -19,    71,  -182,   385,  -737,  1357, -2647,  7584,
+      12777, -3231,  1587,  -859,   456,  -222,    92,   -28},
+    {   -18,    69,  -175,   372,  -714,  1315, -2559,  7234,
+      13050, -3204,  1568,  -849,   451,  -220,    92,   -28},
+    {   -17,    66,  -169,   359,  -690,  1271, -2468,  6883,
+      13318, -3168,  1545,  -836,   444,  -217,    91,   -28},
+    {   -16,    63,  -162,   346,  -664,  1224, -2372,  6533,
+      13575, -3123,  1517,  -821,   436,  -214,    90,   -28},
+    {   -15,    60,  -155,   332,  -638,  1175, -2273,  6183,
+      13823, -3069,  1486,  -803,   428,  -210,    88,   -28},
+    {   -14,    57,  -148,   317,  -610,  1125, -2171,  5835,
+      14060, -3006,  1450,  -783,   417,  -205,    87,   -27},
+    {   -13,    54,  -140,   302,  -581,  1072, -2065,  5488,
+      14288, -2933,  1409,  -761,   406,  -200,    85,   -27},
+    {   -12,    51,  -133,   286,  -552,  1018, -1957,  5143,
+      14508, -2851,  1364,  -736,   393,  -194,    82,   -26},
+    {   -12,    48,  -125,   270,  -522,   962, -1846,  4801,
+      14715, -2759,  1315,  -709,   379,  -187,    80,   -26},
+    {   -11,    44,  -117,   254,  -491,   905, -1734,  4462,
+      14912, -2658,  1262,  -680,   364,  -180,    77,   -25},
+    {   -10,    41,  -109,   237,  -459,   847, -1620,  4127,
+      15097, -2547,  1204,  -649,   347,  -172,    74,   -24},
+    {    -9,    38,  -101,   220,  -427,   787, -1504,  3795,
+      15272, -2427,  1142,  -615,   329,  -163,    70,   -23},
+    {    -8,    35,   -93,   203,  -394,   727, -1387,  3467,
+      15434, -2297,  1076,  -579,   310,  -154,    66,   -22},
+    {    -7,    32,   -85,   186,  -361,   667, -1269,  3145,
+      15581, -2157,  1006,  -541,   290,  -144,    62,   -21},
+    {    -6,    28,   -77,   168,  -328,   606, -1151,  2827,
+      15721, -2008,   932,  -501,   268,  -134,    58,   -19},
+    {    -6,    25,   -69,   151,  -294,   544, -1033,  2514,
+      15847, -1849,   854,  -458,   246,  -123,    53,   -18},
+    {    -5,    22,   -61,   134,  -261,   482,  -914,  2208,
+      15957, -1680,   772,  -414,   222,  -111,    49,   -16},
+    {    -4,    19,   -53,   116,  -227,   421,  -796,  1907,
+      16057, -1502,   687,  -368,   198,   -99,    43,   -15},
+    {    -3,    16,   -45,    99,  -194,   359,  -679,  1613,
+      16144, -1315,   598,  -320,   172,   -86,    38,   -13},
+    {    -3,    13,   -37,    82,  -161,   298,  -562,  1326,
+      16217, -1118,   506,  -271,   146,   -73,    32,   -11},
+    {    -2,    11,   -29,    65,  -128,   237,  -446,  1045,
+      16276,  -912,   410,  -219,   118,   -59,    26,    -9},
+    {    -2,     8,   -22,    48,   -95,   176,  -332,   772,
+      16325,  -697,   312,  -167,    90,   -45,    20,    -7},
+    {    -1,     5,   -14,    32,   -63,   117,  -219,   507,
+      16357,  -474,   210,  -112,    61,   -31,    14,    -5},
+    {     0,     3,    -7,    16,   -31,    58,  -109,   249,
+      16376,  -241,   106,   -57,    31,   -15,     7,    -2},
+    {     0,     0,     0,     0,     0,     0,     0,     0,
+      16384,     0,     0,     0,     0,     0,     0,     0}};
@@ -0,0 +1,1477 @@
+/* Generated by tools/course_generator, do not edit.
+ * One packed CourseBlob per course, see map_course(). */
+
+/* courses/course0.txt */
+static const uint32_t course0_blob[] ONCHIP_RODATA = {
+    0x32535243, 0x00960140, 0x00780000, 0x00640000, 0x00c80140, 0x000c0002,
+    0x00280028, 0x016c00cc, 0x02ac020c, 0x03ec034c, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00010000, 0x00030002, 0x00050004, 0x00070006,
+    0x00090008, 0x000b000a, 0x000d000c, 0x000f000e, 0x00110010, 0x00130012,
+    0x00140014, 0x00140014, 0x00140014, 0x00140014, 0x00140014, 0x00150014,
+    0x00170016, 0x00190018, 0x001b001a, 0x001d001c, 0x001f001e, 0x00210020,
+    0x00230022, 0x00250024, 0x00270026, 0x00280028, 0x00280028, 0x00280028,
+    0x00280028, 0x00280028, 0x00000028, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x42c80000, 0x42c80000, 0x42c80000, 0x42c80000, 0x42c80000,
+    0x42c80000, 0x42c80000, 0x42c80000, 0x42c80000, 0x42c80000, 0x42c80000,
+    0x42c80000, 0x42c80000, 0x42c80000, 0x42c80000, 0x42c80000, 0x42c80000,
+    0x42c80000, 0x42c80000, 0x42c80000, 0x43480000, 0x43480000, 0x43480000,
+    0x43480000, 0x43480000, 0x43480000, 0x43480000, 0x43480000, 0x43480000,
+    0x43480000, 0x43480000, 0x43480000, 0x43480000, 0x43480000, 0x43480000,
+    0x43480000, 0x43480000, 0x43480000, 0x43480000, 0x43480000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x43a00000, 0x43a00000, 0x43a00000, 0x43a00000, 0x43a00000,
+    0x43a00000, 0x43a00000, 0x43a00000, 0x43a00000, 0x43a00000, 0x43a00000,
+    0x43a00000, 0x43a00000, 0x43a00000, 0x43a00000, 0x43a00000, 0x43a00000,
+    0x43a00000, 0x43a00000, 0x43a00000, 0x43a00000, 0x43a00000, 0x43a00000,
+    0x43a00000, 0x43a00000, 0x43a00000, 0x43a00000, 0x43a00000, 0x43a00000,
+    0x43a00000, 0x43a00000, 0x43a00000, 0x43a00000, 0x43a00000, 0x43a00000,
+    0x43a00000, 0x43a00000, 0x43a00000, 0x43a00000, 0x43a00000, 0x00640000,
+    0x01000140, 0x00c80000, 0x01000140, 0x0091013b, 0x02000005, 0x0092013b,
+    0x02000005, 0x0093013b, 0x02000005, 0x0094013b, 0x02000005, 0x0095013b,
+    0x02000005, 0x0096013b, 0x02000005, 0x0097013b, 0x02000005, 0x0098013b,
+    0x02000005, 0x0099013b, 0x02000005, 0x009a013b, 0x02000005};
+
+/* courses/course1.txt */
+static const uint32_t course1_blob[] ONCHIP_RODATA = {
+    0x32535243, 0x00140104, 0x003c0000, 0x00000000, 0x00f00118, 0x00110009,
+    0x008e0028, 0x030400cc, 0x0774053c, 0x0be409ac, 0x00010000, 0x00050003,
+    0x00070007, 0x00080007, 0x000b0009, 0x000f000c, 0x00150013, 0x00170017,
+    0x00180017, 0x001b0019, 0x001e001c, 0x00220021, 0x00230023, 0x00240023,
+    0x00270025, 0x002a0028, 0x002e002d, 0x002f002f, 0x0030002f, 0x00330031,
+    0x00350034, 0x00380037, 0x00390039, 0x003a0039, 0x003d003b, 0x003f003e,
+    0x00440042, 0x00470046, 0x004a0048, 0x004f004c, 0x00530050, 0x005c0058,
+    0x00630060, 0x006a0066, 0x0073006e, 0x00790076, 0x007e007c, 0x00820080,
+    0x00860084, 0x008b0088, 0x0000008e, 0x00000000, 0x00000000, 0x42a00000,
+    0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x43700000, 0x43700000,
+    0x43700000, 0x438c0000, 0x438c0000, 0x00000000, 0x00000000, 0x42200000,
+    0x00000000, 0x00000000, 0x42a00000, 0x42200000, 0x00000000, 0x42a00000,
+    0x00000000, 0x42a00000, 0x43700000, 0x43700000, 0x43700000, 0x438c0000,
+    0x438c0000, 0x00000000, 0x42200000, 0x00000000, 0x42a00000, 0x42200000,
+    0x42a00000, 0x42a00000, 0x43700000, 0x43700000, 0x43700000, 0x438c0000,
+    0x438c0000, 0x00000000, 0x42200000, 0x00000000, 0x42a00000, 0x42200000,
+    0x42a00000, 0x42a00000, 0x43700000, 0x43700000, 0x43700000, 0x438c0000,
+    0x438c0000, 0x42200000, 0x42a00000, 0x42200000, 0x42a00000, 0x42a00000,
+    0x43700000, 0x43700000, 0x43700000, 0x438c0000, 0x438c0000, 0x42200000,
+    0x42a00000, 0x42200000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x438c0000, 0x438c0000, 0x42200000,
+    0x42200000, 0x00000000, 0x42a00000, 0x42200000, 0x42200000, 0x42a00000,
+    0x00000000, 0x42a00000, 0x42200000, 0x42a00000, 0x00000000, 0x42a00000,
+    0x42200000, 0x42a00000, 0x00000000, 0x42200000, 0x42a00000, 0x00000000,
+    0x42200000, 0x42a00000, 0x00000000, 0x42200000, 0x42a00000, 0x00000000,
+    0x43700000, 0x42200000, 0x42a00000, 0x00000000, 0x43700000, 0x42200000,
+    0x42a00000, 0x00000000, 0x43700000, 0x438c0000, 0x42200000, 0x00000000,
+    0x438c0000, 0x42200000, 0x42200000, 0x00000000, 0x42200000, 0x42200000,
+    0x00000000, 0x42200000, 0x00000000, 0x42200000, 0x00000000, 0x42200000,
+    0x00000000, 0x42200000, 0x00000000, 0x42200000, 0x00000000, 0x42200000,
+    0x00000000, 0x42200000, 0x00000000, 0x438c0000, 0x42200000, 0x00000000,
+    0x438c0000, 0x42200000, 0x42200000, 0x43480000, 0x42200000, 0x43480000,
+    0x42200000, 0x43480000, 0x43480000, 0x43480000, 0x43480000, 0x43700000,
+    0x43700000, 0x42200000, 0x42a00000, 0x43700000, 0x42200000, 0x42a00000,
+    0x43480000, 0x43700000, 0x42200000, 0x43480000, 0x42200000, 0x43480000,
+    0x43480000, 0x43480000, 0x43480000, 0x43700000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43480000, 0x43700000, 0x43480000, 0x43480000,
+    0x43480000, 0x43480000, 0x43480000, 0x43700000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43480000, 0x43700000, 0x43480000, 0x43480000,
+    0x43480000, 0x43480000, 0x43480000, 0x43700000, 0x43700000, 0x43700000,
+    0x43480000, 0x43700000, 0x43480000, 0x43480000, 0x43480000, 0x43480000,
+    0x43480000, 0x43700000, 0x43700000, 0x43700000, 0x43480000, 0x43700000,
+    0x43480000, 0x43480000, 0x43480000, 0x43480000, 0x43480000, 0x43480000,
+    0x43480000, 0x43480000, 0x43480000, 0x43480000, 0x43480000, 0x43480000,
+    0x43480000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x43480000, 0x43700000, 0x43700000, 0x43480000, 0x43700000, 0x43480000,
+    0x43700000, 0x43480000, 0x43700000, 0x43480000, 0x43700000, 0x43480000,
+    0x43700000, 0x43700000, 0x43480000, 0x43700000, 0x43700000, 0x43480000,
+    0x43700000, 0x43700000, 0x43480000, 0x43700000, 0x43480000, 0x43700000,
+    0x43480000, 0x43700000, 0x43480000, 0x43700000, 0x43480000, 0x43700000,
+    0x43480000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x80000000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x80000000,
+    0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x3f800000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x80000000, 0x80000000, 0x3f800000, 0x3f800000,
+    0x80000000, 0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000,
+    0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x80000000, 0x80000000, 0x3f800000, 0x3f800000,
+    0x80000000, 0x80000000, 0x3f800000, 0x3f800000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x3f800000,
+    0x80000000, 0x80000000, 0x3f800000, 0x3f800000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x3f800000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x3f800000, 0x80000000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x80000000,
+    0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x00000000, 0x3f800000,
+    0x00000000, 0x3f800000, 0x00000000, 0x00000000, 0x00000000, 0x80000000,
+    0x3f800000, 0x3f800000, 0x80000000, 0x80000000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x00000000, 0x3f800000, 0x3f800000, 0x3f800000, 0x00000000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x00000000, 0x00000000, 0x3f800000, 0x3f800000,
+    0x00000000, 0x80000000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x00000000, 0x3f800000, 0x3f800000,
+    0x00000000, 0x42a00000, 0x42a00000, 0x43200000, 0x42a00000, 0x43200000,
+    0x42a00000, 0x43200000, 0x43480000, 0x43480000, 0x43480000, 0x43700000,
+    0x43700000, 0x42a00000, 0x42200000, 0x43200000, 0x42a00000, 0x42200000,
+    0x43200000, 0x43200000, 0x42a00000, 0x43200000, 0x42a00000, 0x43200000,
+    0x43480000, 0x43480000, 0x43480000, 0x43700000, 0x43700000, 0x42200000,
+    0x43200000, 0x42200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000,
+    0x43480000, 0x43480000, 0x43480000, 0x43700000, 0x43700000, 0x42200000,
+    0x43200000, 0x42200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000,
+    0x43480000, 0x43480000, 0x43480000, 0x43700000, 0x43700000, 0x43200000,
+    0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43480000, 0x43480000,
+    0x43480000, 0x43700000, 0x43700000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x43200000, 0x43480000, 0x43200000, 0x43480000, 0x43200000,
+    0x43480000, 0x43700000, 0x43700000, 0x43200000, 0x43700000, 0x438c0000,
+    0x43200000, 0x43200000, 0x43700000, 0x43200000, 0x438c0000, 0x43200000,
+    0x43700000, 0x43200000, 0x438c0000, 0x43200000, 0x43700000, 0x43200000,
+    0x438c0000, 0x43700000, 0x43200000, 0x438c0000, 0x43700000, 0x43200000,
+    0x438c0000, 0x43700000, 0x43200000, 0x438c0000, 0x43480000, 0x43700000,
+    0x43200000, 0x438c0000, 0x43480000, 0x43700000, 0x43200000, 0x438c0000,
+    0x43480000, 0x43700000, 0x43700000, 0x438c0000, 0x43700000, 0x43200000,
+    0x43700000, 0x438c0000, 0x43200000, 0x43700000, 0x438c0000, 0x43700000,
+    0x438c0000, 0x43700000, 0x438c0000, 0x43700000, 0x438c0000, 0x43700000,
+    0x438c0000, 0x43700000, 0x438c0000, 0x43700000, 0x438c0000, 0x43700000,
+    0x438c0000, 0x43700000, 0x43700000, 0x438c0000, 0x43700000, 0x00280000,
+    0x01000051, 0x00500000, 0x01000029, 0x00280050, 0x010100a1, 0x00500028,
+    0x010100a0, 0x00c80050, 0x010000a1, 0x000000f0, 0x010100c9, 0x00000118,
+    0x010100f0, 0x000f00ff, 0x0200000a, 0x001000ff, 0x0200000a, 0x001100ff,
+    0x0200000a, 0x001200ff, 0x0200000a, 0x001300ff, 0x0200000a, 0x001400ff,
+    0x0200000a, 0x001500ff, 0x0200000a, 0x001600ff, 0x0200000a, 0x001700ff,
+    0x0200000a, 0x001800ff, 0x0200000a};
+
+/* courses/course2.txt */
+static const uint32_t course2_blob[] ONCHIP_RODATA = {
+    0x32535243, 0x00aa012c, 0x0046000a, 0x00320000, 0x00c80140, 0x00120008,
+    0x00680028, 0x026c00cc, 0x05ac040c, 0x08ec074c, 0x00010000, 0x00030002,
+    0x00050004, 0x00090007, 0x00090009, 0x000a0009, 0x000c000b, 0x000e000d,
+    0x00120010, 0x00120012, 0x00140012, 0x00180016, 0x001d001a, 0x00230021,
+    0x00230023, 0x00240023, 0x00260025, 0x00290027, 0x002d002c, 0x002d002d,
+    0x002f002d, 0x00330031, 0x00360034, 0x003c003a, 0x003e003d, 0x0042003f,
+    0x00480045, 0x004d004a, 0x00550052, 0x00590057, 0x005d005b, 0x0061005f,
+    0x00630062, 0x00650064, 0x00670066, 0x00680068, 0x00680068, 0x00680068,
+    0x00680068, 0x00680068, 0x00000068, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x43480000, 0x00000000, 0x43480000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x43480000,
+    0x00000000, 0x43480000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x43160000, 0x00000000, 0x00000000, 0x43160000, 0x43480000, 0x00000000,
+    0x43480000, 0x00000000, 0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x43160000, 0x00000000, 0x43160000, 0x43480000, 0x43480000,
+    0x42480000, 0x42480000, 0x42480000, 0x42480000, 0x42480000, 0x42480000,
+    0x42480000, 0x43160000, 0x42480000, 0x43480000, 0x43160000, 0x43480000,
+    0x42480000, 0x43480000, 0x43480000, 0x43480000, 0x43480000, 0x43480000,
+    0x42480000, 0x42480000, 0x42480000, 0x42480000, 0x42480000, 0x42480000,
+    0x42480000, 0x42480000, 0x42480000, 0x42480000, 0x42480000, 0x43160000,
+    0x42480000, 0x42480000, 0x43480000, 0x43160000, 0x43480000, 0x42480000,
+    0x42480000, 0x43480000, 0x43480000, 0x42480000, 0x43480000, 0x42480000,
+    0x43480000, 0x42480000, 0x43480000, 0x42480000, 0x42480000, 0x42480000,
+    0x42480000, 0x42480000, 0x42480000, 0x42480000, 0x42480000, 0x42480000,
+    0x42480000, 0x42480000, 0x42480000, 0x42480000, 0x42480000, 0x42480000,
+    0x42480000, 0x42480000, 0x42480000, 0x42480000, 0x43160000, 0x42480000,
+    0x43160000, 0x42480000, 0x42480000, 0x42480000, 0x42480000, 0x42480000,
+    0x42480000, 0x43160000, 0x42480000, 0x43160000, 0x42480000, 0x42c80000,
+    0x42480000, 0x42c80000, 0x42480000, 0x42c80000, 0x42480000, 0x42c80000,
+    0x42480000, 0x42c80000, 0x43160000, 0x42480000, 0x42c80000, 0x43160000,
+    0x43160000, 0x42480000, 0x43160000, 0x42480000, 0x42c80000, 0x42c80000,
+    0x42c80000, 0x42c80000, 0x42c80000, 0x43160000, 0x42c80000, 0x43160000,
+    0x43160000, 0x43160000, 0x43160000, 0x43480000, 0x43160000, 0x43480000,
+    0x43160000, 0x43480000, 0x43160000, 0x43160000, 0x43160000, 0x43160000,
+    0x43160000, 0x43160000, 0x43160000, 0x43160000, 0x43160000, 0x43160000,
+    0x43160000, 0x43160000, 0x43160000, 0x43480000, 0x43480000, 0x43160000,
+    0x43480000, 0x43480000, 0x43160000, 0x43480000, 0x43480000, 0x43160000,
+    0x43480000, 0x43160000, 0x43160000, 0x43480000, 0x43160000, 0x43160000,
+    0x43160000, 0x43160000, 0x43480000, 0x43160000, 0x43160000, 0x43480000,
+    0x43160000, 0x43480000, 0x43160000, 0x43480000, 0x43160000, 0x43480000,
+    0x43480000, 0x43480000, 0x43480000, 0x43480000, 0x43480000, 0x43480000,
+    0x43480000, 0x43480000, 0x43480000, 0x43480000, 0x43480000, 0x43480000,
+    0x43480000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x3f800000, 0x80000000,
+    0x80000000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x80000000, 0x3f800000, 0x3f800000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x3f800000,
+    0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x3f800000,
+    0x80000000, 0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000,
+    0x80000000, 0x3f800000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x3f800000, 0x80000000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x80000000, 0x80000000,
+    0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x80000000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x43480000,
+    0x43480000, 0x43480000, 0x43480000, 0x43480000, 0x42c80000, 0x43480000,
+    0x42c80000, 0x43480000, 0x43480000, 0x43480000, 0x43480000, 0x43480000,
+    0x43480000, 0x42c80000, 0x43480000, 0x42c80000, 0x43480000, 0x43160000,
+    0x43480000, 0x43160000, 0x43480000, 0x43160000, 0x43480000, 0x43160000,
+    0x43480000, 0x43160000, 0x42480000, 0x43480000, 0x43160000, 0x42480000,
+    0x42c80000, 0x43480000, 0x42c80000, 0x43480000, 0x43160000, 0x43160000,
+    0x43160000, 0x43160000, 0x43160000, 0x42480000, 0x43160000, 0x42480000,
+    0x42c80000, 0x42c80000, 0x42c80000, 0x42480000, 0x42c80000, 0x42480000,
+    0x42c80000, 0x42480000, 0x42c80000, 0x42480000, 0x42c80000, 0x42f00000,
+    0x42480000, 0x42c80000, 0x42c80000, 0x42f00000, 0x42c80000, 0x42f00000,
+    0x42f00000, 0x42f00000, 0x42c80000, 0x42480000, 0x43868000, 0x42c80000,
+    0x42480000, 0x43868000, 0x42c80000, 0x42480000, 0x43868000, 0x42c80000,
+    0x43868000, 0x42480000, 0x42c80000, 0x43868000, 0x42f00000, 0x42480000,
+    0x42c80000, 0x42c80000, 0x43868000, 0x42f00000, 0x42c80000, 0x43868000,
+    0x42f00000, 0x43868000, 0x42f00000, 0x43868000, 0x42f00000, 0x43868000,
+    0x42480000, 0x43868000, 0x42480000, 0x43868000, 0x42480000, 0x43868000,
+    0x43868000, 0x43868000, 0x43868000, 0x43868000, 0x43868000, 0x43868000,
+    0x43868000, 0x00640000, 0x01000097, 0x009600c8, 0x01000078, 0x00640096,
+    0x01010033, 0x003200c8, 0x01010065, 0x00960032, 0x01000065, 0x00320000,
+    0x010000c9, 0x00960032, 0x01010033, 0x00c80032, 0x0100010e, 0x00a50127,
+    0x0200000a, 0x00a60127, 0x0200000a, 0x00a70127, 0x0200000a, 0x00a80127,
+    0x0200000a, 0x00a90127, 0x0200000a, 0x00aa0127, 0x0200000a, 0x00ab0127,
+    0x0200000a, 0x00ac0127, 0x0200000a, 0x00ad0127, 0x0200000a, 0x00ae0127,
+    0x0200000a};
+
+/* courses/course3.txt */
+static const uint32_t course3_blob[] ONCHIP_RODATA = {
+    0x32535243, 0x0078012c, 0x0078000a, 0x00140000, 0x00dc0140, 0x01020008,
+    0x00690028, 0x027000cc, 0x05b80414, 0x0900075c, 0x00010000, 0x00030002,
+    0x00070005, 0x00090008, 0x000b000a, 0x000d000c, 0x000f000e, 0x00160012,
+    0x001b0019, 0x001d001c, 0x001f001e, 0x00210020, 0x00260023, 0x00290028,
+    0x00290029, 0x00290029, 0x00290029, 0x002f002b, 0x00350033, 0x00350035,
+    0x00360035, 0x00380037, 0x0040003b, 0x00460044, 0x00460046, 0x00470046,
+    0x00490048, 0x004e004b, 0x00510050, 0x00510051, 0x00520051, 0x00540053,
+    0x00580056, 0x005a0059, 0x005c005b, 0x005e005d, 0x0060005f, 0x00640062,
+    0x00660065, 0x00680067, 0x00000069, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x42f00000, 0x00000000, 0x42f00000, 0x42f00000, 0x42f00000,
+    0x42f00000, 0x42f00000, 0x42f00000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x42f00000, 0x42f00000, 0x00000000, 0x42f00000, 0x43480000,
+    0x42f00000, 0x42f00000, 0x43480000, 0x42f00000, 0x42f00000, 0x43480000,
+    0x42f00000, 0x42f00000, 0x42f00000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x42f00000, 0x00000000, 0x43480000, 0x42f00000, 0x43480000,
+    0x42f00000, 0x43480000, 0x43200000, 0x42f00000, 0x43480000, 0x43200000,
+    0x43200000, 0x42f00000, 0x43480000, 0x43200000, 0x43200000, 0x42f00000,
+    0x43480000, 0x43200000, 0x42f00000, 0x42f00000, 0x42f00000, 0x42f00000,
+    0x43200000, 0x42f00000, 0x42f00000, 0x43480000, 0x43200000, 0x43200000,
+    0x42f00000, 0x43480000, 0x43200000, 0x43200000, 0x42f00000, 0x43480000,
+    0x43200000, 0x42f00000, 0x42f00000, 0x42f00000, 0x42f00000, 0x43200000,
+    0x42f00000, 0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000,
+    0x42f00000, 0x42f00000, 0x42f00000, 0x42f00000, 0x42f00000, 0x42f00000,
+    0x42f00000, 0x42f00000, 0x42f00000, 0x42f00000, 0x42f00000, 0x42f00000,
+    0x42f00000, 0x42f00000, 0x42f00000, 0x42f00000, 0x42f00000, 0x42f00000,
+    0x42f00000, 0x42f00000, 0x42f00000, 0x42f00000, 0x42f00000, 0x42f00000,
+    0x42700000, 0x42700000, 0x42700000, 0x42700000, 0x41a00000, 0x42700000,
+    0x41a00000, 0x41a00000, 0x41a00000, 0x41a00000, 0x41a00000, 0x41a00000,
+    0x42700000, 0x42700000, 0x42700000, 0x42700000, 0x41a00000, 0x42f00000,
+    0x42700000, 0x41a00000, 0x42f00000, 0x42f00000, 0x41a00000, 0x42f00000,
+    0x42f00000, 0x41a00000, 0x42f00000, 0x41a00000, 0x41a00000, 0x41a00000,
+    0x42700000, 0x42700000, 0x42700000, 0x42700000, 0x42f00000, 0x42700000,
+    0x42f00000, 0x42f00000, 0x42f00000, 0x42f00000, 0x42f00000, 0x43200000,
+    0x42f00000, 0x42f00000, 0x43200000, 0x43200000, 0x42f00000, 0x42f00000,
+    0x43200000, 0x43200000, 0x42f00000, 0x42f00000, 0x43200000, 0x435c0000,
+    0x435c0000, 0x435c0000, 0x435c0000, 0x43200000, 0x42f00000, 0x435c0000,
+    0x42f00000, 0x43200000, 0x43200000, 0x42f00000, 0x42f00000, 0x43200000,
+    0x43200000, 0x42f00000, 0x42f00000, 0x43200000, 0x435c0000, 0x435c0000,
+    0x435c0000, 0x435c0000, 0x43200000, 0x435c0000, 0x43200000, 0x43200000,
+    0x43200000, 0x43200000, 0x43200000, 0x435c0000, 0x435c0000, 0x435c0000,
+    0x435c0000, 0x435c0000, 0x435c0000, 0x435c0000, 0x435c0000, 0x435c0000,
+    0x435c0000, 0x435c0000, 0x435c0000, 0x435c0000, 0x435c0000, 0x435c0000,
+    0x435c0000, 0x435c0000, 0x435c0000, 0x435c0000, 0x435c0000, 0x435c0000,
+    0x435c0000, 0x435c0000, 0x435c0000, 0x3ea1e89b, 0x3ea1e89b, 0x3ea1e89b,
+    0x3ea1e89b, 0x80000000, 0x3ea1e89b, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x3ea1e89b, 0x3ea1e89b, 0x3ea1e89b,
+    0x3ea1e89b, 0x80000000, 0x3f3504f3, 0x3ea1e89b, 0x80000000, 0x3f3504f3,
+    0x3f3504f3, 0x80000000, 0x3f3504f3, 0x3f3504f3, 0x80000000, 0x3f3504f3,
+    0x80000000, 0x80000000, 0x80000000, 0x3ea1e89b, 0x3ea1e89b, 0x3ea1e89b,
+    0x3ea1e89b, 0x3f3504f3, 0x3ea1e89b, 0x3f3504f3, 0x3f3504f3, 0x3f3504f3,
+    0x3f3504f3, 0x3f3504f3, 0x3f3504f3, 0x3f3504f3, 0x3f3504f3, 0x3f3504f3,
+    0x3f3504f3, 0x3f3504f3, 0x3f3504f3, 0x3f3504f3, 0x3f3504f3, 0x3f3504f3,
+    0x3f3504f3, 0x3f3504f3, 0x3ea1e89b, 0x3ea1e89b, 0x3ea1e89b, 0x3ea1e89b,
+    0x3f3504f3, 0x3f3504f3, 0x3ea1e89b, 0x3f3504f3, 0x3f3504f3, 0x3f3504f3,
+    0x3f3504f3, 0x3f3504f3, 0x3f3504f3, 0x3f3504f3, 0x3f3504f3, 0x3f3504f3,
+    0x3f3504f3, 0x3ea1e89b, 0x3ea1e89b, 0x3ea1e89b, 0x3ea1e89b, 0x3f3504f3,
+    0x3ea1e89b, 0x3f3504f3, 0x3f3504f3, 0x3f3504f3, 0x3f3504f3, 0x3f3504f3,
+    0x3ea1e89b, 0x3ea1e89b, 0x3ea1e89b, 0x3ea1e89b, 0x80000000, 0x3ea1e89b,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x3ea1e89b, 0x3ea1e89b, 0x3ea1e89b, 0x3ea1e89b, 0x80000000, 0x3ea1e89b,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x3f72dce9, 0x3f72dce9, 0x3f72dce9, 0x3f72dce9, 0x3f800000, 0x3f72dce9,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f72dce9, 0x3f72dce9, 0x3f72dce9, 0x3f72dce9, 0x3f800000, 0x3f3504f3,
+    0x3f72dce9, 0x3f800000, 0xbf3504f3, 0x3f3504f3, 0x3f800000, 0xbf3504f3,
+    0x3f3504f3, 0x3f800000, 0xbf3504f3, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f72dce9, 0x3f72dce9, 0x3f72dce9, 0x3f72dce9, 0x3f3504f3, 0x3f72dce9,
+    0xbf3504f3, 0x3f3504f3, 0xbf3504f3, 0x3f3504f3, 0xbf3504f3, 0xbf3504f3,
+    0x3f3504f3, 0xbf3504f3, 0x3f3504f3, 0xbf3504f3, 0x3f3504f3, 0xbf3504f3,
+    0x3f3504f3, 0xbf3504f3, 0x3f3504f3, 0xbf3504f3, 0x3f3504f3, 0xbf72dce9,
+    0xbf72dce9, 0xbf72dce9, 0xbf72dce9, 0xbf3504f3, 0x3f3504f3, 0xbf72dce9,
+    0xbf3504f3, 0x3f3504f3, 0xbf3504f3, 0x3f3504f3, 0xbf3504f3, 0x3f3504f3,
+    0xbf3504f3, 0x3f3504f3, 0xbf3504f3, 0x3f3504f3, 0xbf72dce9, 0xbf72dce9,
+    0xbf72dce9, 0xbf72dce9, 0xbf3504f3, 0xbf72dce9, 0x3f3504f3, 0xbf3504f3,
+    0x3f3504f3, 0xbf3504f3, 0x3f3504f3, 0xbf72dce9, 0xbf72dce9, 0xbf72dce9,
+    0xbf72dce9, 0x3f800000, 0xbf72dce9, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0xbf72dce9, 0xbf72dce9, 0xbf72dce9,
+    0xbf72dce9, 0x3f800000, 0xbf72dce9, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x42fcfb72, 0x42fcfb72, 0x42fcfb72,
+    0x42fcfb72, 0x43480000, 0x42fcfb72, 0x43480000, 0x43480000, 0x43480000,
+    0x43480000, 0x43480000, 0x43480000, 0x42fcfb72, 0x42fcfb72, 0x42fcfb72,
+    0x42fcfb72, 0x43480000, 0x42624630, 0x42fcfb72, 0x43480000, 0x42624630,
+    0x42624630, 0x43480000, 0x42624630, 0x42624630, 0x43480000, 0x42624630,
+    0x43480000, 0x43480000, 0x43480000, 0x42fcfb72, 0x42fcfb72, 0x42fcfb72,
+    0x42fcfb72, 0x42624630, 0x42fcfb72, 0x42624630, 0x42624630, 0x42624630,
+    0x42624630, 0x42624630, 0x42624630, 0x42624630, 0x42624630, 0x42624630,
+    0x42624630, 0x42624630, 0x42624630, 0x42624630, 0x42624630, 0x42624630,
+    0x42624630, 0x42624630, 0x42fcfb72, 0x42fcfb72, 0x42fcfb72, 0x42fcfb72,
+    0x42624630, 0x42624630, 0x42fcfb72, 0x42624630, 0x42624630, 0x42624630,
+    0x42624630, 0x42624630, 0x42624630, 0x42624630, 0x42624630, 0x42624630,
+    0x42624630, 0x42fcfb72, 0x42fcfb72, 0x42fcfb72, 0x42fcfb72, 0x42624630,
+    0x42fcfb72, 0x42624630, 0x42624630, 0x42624630, 0x42624630, 0x42624630,
+    0x42fcfb72, 0x42fcfb72, 0x42fcfb72, 0x42fcfb72, 0x43480000, 0x42fcfb72,
+    0x43480000, 0x43480000, 0x43480000, 0x43480000, 0x43480000, 0x43480000,
+    0x42fcfb72, 0x42fcfb72, 0x42fcfb72, 0x42fcfb72, 0x43480000, 0x42fcfb72,
+    0x43480000, 0x43480000, 0x43480000, 0x43480000, 0x43480000, 0x43480000,
+    0x00140077, 0x01000002, 0x00150074, 0x01000003, 0x00160071, 0x01000003,
+    0x0017006e, 0x01000003, 0x0018006b, 0x01000003, 0x00190068, 0x01000003,
+    0x001a0065, 0x01000003, 0x001b0062, 0x01000003, 0x001c005f, 0x01000003,
+    0x001d005c, 0x01000003, 0x001e0059, 0x01000003, 0x001f0056, 0x01000003,
+    0x00200053, 0x01000003, 0x00210050, 0x01000003, 0x0022004d, 0x01000003,
+    0x0023004a, 0x01000003, 0x00240047, 0x01000003, 0x00250044, 0x01000003,
+    0x00260041, 0x01000003, 0x0027003e, 0x01000003, 0x0028003b, 0x01000003,
+    0x00290038, 0x01000003, 0x002a0035, 0x01000003, 0x002b0032, 0x01000003,
+    0x002c002f, 0x01000003, 0x002d002c, 0x01000003, 0x002e0029, 0x01000003,
+    0x002f0026, 0x01000003, 0x00300023, 0x01000003, 0x00310020, 0x01000003,
+    0x0032001d, 0x01000003, 0x0033001a, 0x01000003, 0x00340017, 0x01000003,
+    0x00350014, 0x01000003, 0x00360011, 0x01000003, 0x0037000e, 0x01000003,
+    0x0038000b, 0x01000003, 0x00390008, 0x01000003, 0x003a0005, 0x01000003,
+    0x003b0002, 0x01000003, 0x003c0000, 0x01000002, 0x00b40000, 0x01000002,
+    0x00b50002, 0x01000003, 0x00b60005, 0x01000003, 0x00b70008, 0x01000003,
+    0x00b8000b, 0x01000003, 0x00b9000e, 0x01000003, 0x00ba0011, 0x01000003,
+    0x00bb0014, 0x01000003, 0x00bc0017, 0x01000003, 0x00bd001a, 0x01000003,
+    0x00be001d, 0x01000003, 0x00bf0020, 0x01000003, 0x00c00023, 0x01000003,
+    0x00c10026, 0x01000003, 0x00c20029, 0x01000003, 0x00c3002c, 0x01000003,
+    0x00c4002f, 0x01000003, 0x00c50032, 0x01000003, 0x00c60035, 0x01000003,
+    0x00c70038, 0x01000003, 0x00c8003b, 0x01000003, 0x00c9003e, 0x01000003,
+    0x00ca0041, 0x01000003, 0x00cb0044, 0x01000003, 0x00cc0047, 0x01000003,
+    0x00cd004a, 0x01000003, 0x00ce004d, 0x01000003, 0x00cf0050, 0x01000003,
+    0x00d00053, 0x01000003, 0x00d10056, 0x01000003, 0x00d20059, 0x01000003,
+    0x00d3005c, 0x01000003, 0x00d4005f, 0x01000003, 0x00d50062, 0x01000003,
+    0x00d60065, 0x01000003, 0x00d70068, 0x01000003, 0x00d8006b, 0x01000003,
+    0x00d9006e, 0x01000003, 0x00da0071, 0x01000003, 0x00db0074, 0x01000003,
+    0x00dc0077, 0x01000002, 0x00140078, 0x010000c8, 0x00dc0078, 0x010000c8,
+    0x005000a0, 0x01000001, 0x005100a1, 0x01000001, 0x005200a2, 0x01000001,
+    0x005300a3, 0x01000001, 0x005400a4, 0x01000001, 0x005500a5, 0x01000001,
+    0x005600a6, 0x01000001, 0x005700a7, 0x01000001, 0x005800a8, 0x01000001,
+    0x005900a9, 0x01000001, 0x005a00aa, 0x01000001, 0x005b00ab, 0x01000001,
+    0x005c00ac, 0x01000001, 0x005d00ad, 0x01000001, 0x005e00ae, 0x01000001,
+    0x005f00af, 0x01000001, 0x006000b0, 0x01000001, 0x006100b1, 0x01000001,
+    0x006200b2, 0x01000001, 0x006300b3, 0x01000001, 0x006400b4, 0x01000001,
+    0x006500b5, 0x01000001, 0x006600b6, 0x01000001, 0x006700b7, 0x01000001,
+    0x006800b8, 0x01000001, 0x006900b9, 0x01000001, 0x006a00ba, 0x01000001,
+    0x006b00bb, 0x01000001, 0x006c00bc, 0x01000001, 0x006d00bd, 0x01000001,
+    0x006e00be, 0x01000001, 0x006f00bf, 0x01000001, 0x007000c0, 0x01000001,
+    0x007100c1, 0x01000001, 0x007200c2, 0x01000001, 0x007300c3, 0x01000001,
+    0x007400c4, 0x01000001, 0x007500c5, 0x01000001, 0x007600c6, 0x01000001,
+    0x007700c7, 0x01000001, 0x007800c8, 0x01000001, 0x007800c8, 0x01000001,
+    0x007900c7, 0x01000001, 0x007a00c6, 0x01000001, 0x007b00c5, 0x01000001,
+    0x007c00c4, 0x01000001, 0x007d00c3, 0x01000001, 0x007e00c2, 0x01000001,
+    0x007f00c1, 0x01000001, 0x008000c0, 0x01000001, 0x008100bf, 0x01000001,
+    0x008200be, 0x01000001, 0x008300bd, 0x01000001, 0x008400bc, 0x01000001,
+    0x008500bb, 0x01000001, 0x008600ba, 0x01000001, 0x008700b9, 0x01000001,
+    0x008800b8, 0x01000001, 0x008900b7, 0x01000001, 0x008a00b6, 0x01000001,
+    0x008b00b5, 0x01000001, 0x008c00b4, 0x01000001, 0x008d00b3, 0x01000001,
+    0x008e00b2, 0x01000001, 0x008f00b1, 0x01000001, 0x009000b0, 0x01000001,
+    0x009100af, 0x01000001, 0x009200ae, 0x01000001, 0x009300ad, 0x01000001,
+    0x009400ac, 0x01000001, 0x009500ab, 0x01000001, 0x009600aa, 0x01000001,
+    0x009700a9, 0x01000001, 0x009800a8, 0x01000001, 0x009900a7, 0x01000001,
+    0x009a00a6, 0x01000001, 0x009b00a5, 0x01000001, 0x009c00a4, 0x01000001,
+    0x009d00a3, 0x01000001, 0x009e00a2, 0x01000001, 0x009f00a1, 0x01000001,
+    0x00a000a0, 0x01000001, 0x00780078, 0x01000001, 0x00790079, 0x01000001,
+    0x007a007a, 0x01000001, 0x007b007b, 0x01000001, 0x007c007c, 0x01000001,
+    0x007d007d, 0x01000001, 0x007e007e, 0x01000001, 0x007f007f, 0x01000001,
+    0x00800080, 0x01000001, 0x00810081, 0x01000001, 0x00820082, 0x01000001,
+    0x00830083, 0x01000001, 0x00840084, 0x01000001, 0x00850085, 0x01000001,
+    0x00860086, 0x01000001, 0x00870087, 0x01000001, 0x00880088, 0x01000001,
+    0x00890089, 0x01000001, 0x008a008a, 0x01000001, 0x008b008b, 0x01000001,
+    0x008c008c, 0x01000001, 0x008d008d, 0x01000001, 0x008e008e, 0x01000001,
+    0x008f008f, 0x01000001, 0x00900090, 0x01000001, 0x00910091, 0x01000001,
+    0x00920092, 0x01000001, 0x00930093, 0x01000001, 0x00940094, 0x01000001,
+    0x00950095, 0x01000001, 0x00960096, 0x01000001, 0x00970097, 0x01000001,
+    0x00980098, 0x01000001, 0x00990099, 0x01000001, 0x009a009a, 0x01000001,
+    0x009b009b, 0x01000001, 0x009c009c, 0x01000001, 0x009d009d, 0x01000001,
+    0x009e009e, 0x01000001, 0x009f009f, 0x01000001, 0x00a000a0, 0x01000001,
+    0x005000a0, 0x01000001, 0x0051009f, 0x01000001, 0x0052009e, 0x01000001,
+    0x0053009d, 0x01000001, 0x0054009c, 0x01000001, 0x0055009b, 0x01000001,
+    0x0056009a, 0x01000001, 0x00570099, 0x01000001, 0x00580098, 0x01000001,
+    0x00590097, 0x01000001, 0x005a0096, 0x01000001, 0x005b0095, 0x01000001,
+    0x005c0094, 0x01000001, 0x005d0093, 0x01000001, 0x005e0092, 0x01000001,
+    0x005f0091, 0x01000001, 0x00600090, 0x01000001, 0x0061008f, 0x01000001,
+    0x0062008e, 0x01000001, 0x0063008d, 0x01000001, 0x0064008c, 0x01000001,
+    0x0065008b, 0x01000001, 0x0066008a, 0x01000001, 0x00670089, 0x01000001,
+    0x00680088, 0x01000001, 0x00690087, 0x01000001, 0x006a0086, 0x01000001,
+    0x006b0085, 0x01000001, 0x006c0084, 0x01000001, 0x006d0083, 0x01000001,
+    0x006e0082, 0x01000001, 0x006f0081, 0x01000001, 0x00700080, 0x01000001,
+    0x0071007f, 0x01000001, 0x0072007e, 0x01000001, 0x0073007d, 0x01000001,
+    0x0074007c, 0x01000001, 0x0075007b, 0x01000001, 0x0076007a, 0x01000001,
+    0x00770079, 0x01000001, 0x00780078, 0x01000001, 0x00730127, 0x0200000a,
+    0x00740127, 0x0200000a, 0x00750127, 0x0200000a, 0x00760127, 0x0200000a,
+    0x00770127, 0x0200000a, 0x00780127, 0x0200000a, 0x00790127, 0x0200000a,
+    0x007a0127, 0x0200000a, 0x007b0127, 0x0200000a, 0x007c0127, 0x0200000a};
+
+/* Seed 1, par 4 */
+static const uint32_t course4_blob[] ONCHIP_RODATA = {
+    0x32535243, 0x0039001a, 0x0078000a, 0x00000000, 0x00f00140, 0x00110007,
+    0x00670028, 0x026800cc, 0x05a00404, 0x08d8073c, 0x00000000, 0x00000000,
+    0x00010000, 0x00030002, 0x00050004, 0x00060005, 0x000a0008, 0x000e000c,
+    0x00120010, 0x00160014, 0x00180017, 0x001c001a, 0x0020001e, 0x00240022,
+    0x00280026, 0x002a0029, 0x002e002c, 0x00320030, 0x00360034, 0x003a0038,
+    0x003b003b, 0x003d003c, 0x0042003f, 0x00460044, 0x004a0048, 0x004b004b,
+    0x004d004c, 0x0052004f, 0x00560054, 0x005a0058, 0x005b005b, 0x005b005b,
+    0x005e005c, 0x0060005f, 0x00620061, 0x00620062, 0x00620062, 0x00630062,
+    0x00650064, 0x00670066, 0x00000067, 0x43200000, 0x43200000, 0x43700000,
+    0x43700000, 0x43700000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000,
+    0x00000000, 0x42a00000, 0x00000000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000,
+    0x43200000, 0x43200000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000,
+    0x00000000, 0x42a00000, 0x00000000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000,
+    0x43200000, 0x43200000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000,
+    0x00000000, 0x42a00000, 0x00000000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000,
+    0x43200000, 0x43200000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42f00000,
+    0x43200000, 0x43200000, 0x42f00000, 0x43200000, 0x43200000, 0x43700000,
+    0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43200000,
+    0x42a00000, 0x42a00000, 0x42a00000, 0x42f00000, 0x43200000, 0x43200000,
+    0x42f00000, 0x43200000, 0x43200000, 0x43700000, 0x43200000, 0x43700000,
+    0x43200000, 0x43700000, 0x43200000, 0x43200000, 0x42f00000, 0x43200000,
+    0x42f00000, 0x43200000, 0x43700000, 0x43700000, 0x43700000, 0x43200000,
+    0x43200000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x42a00000, 0x43200000, 0x42a00000,
+    0x43200000, 0x42a00000, 0x43200000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x42a00000, 0x42a00000, 0x43200000, 0x42a00000,
+    0x43200000, 0x42a00000, 0x43200000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x42a00000, 0x42a00000, 0x43200000, 0x42a00000,
+    0x43200000, 0x42a00000, 0x43200000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x42a00000, 0x43200000, 0x43200000, 0x43200000,
+    0x43480000, 0x43700000, 0x43200000, 0x43480000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43480000, 0x43700000,
+    0x43200000, 0x43480000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43200000, 0x43480000,
+    0x43700000, 0x43480000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x80000000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x3f800000, 0x80000000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000,
+    0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43200000,
+    0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000,
+    0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43200000,
+    0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000,
+    0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43200000,
+    0x42a00000, 0x42a00000, 0x42a00000, 0x42200000, 0x43700000, 0x43200000,
+    0x42200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000,
+    0x43200000, 0x43700000, 0x43200000, 0x43200000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x42200000, 0x43700000, 0x43200000, 0x42200000, 0x43700000,
+    0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000,
+    0x43200000, 0x43200000, 0x42200000, 0x43700000, 0x42200000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x43700000, 0x00500050, 0x01010051, 0x000000a0, 0x010100f0,
+    0x000000f0, 0x010100f0, 0x00500000, 0x01000051, 0x005000a0, 0x010000a0,
+    0x00a000a0, 0x010000a0, 0x00a00078, 0x01010029, 0x00340015, 0x0200000a,
+    0x00350015, 0x0200000a, 0x00360015, 0x0200000a, 0x00370015, 0x0200000a,
+    0x00380015, 0x0200000a, 0x00390015, 0x0200000a, 0x003a0015, 0x0200000a,
+    0x003b0015, 0x0200000a, 0x003c0015, 0x0200000a, 0x003d0015, 0x0200000a};
+
+/* Seed 2, par 5 */
+static const uint32_t course5_blob[] ONCHIP_RODATA = {
+    0x32535243, 0x00da00c2, 0x00c8000a, 0x00000028, 0x00f00140, 0x00110007,
+    0x00610028, 0x025000cc, 0x055803d4, 0x086006dc, 0x00010000, 0x00020002,
+    0x00030002, 0x00050004, 0x00070006, 0x00080007, 0x000b000a, 0x000e000c,
+    0x00120010, 0x00160014, 0x00170017, 0x00190018, 0x001c001a, 0x0020001e,
+    0x00240022, 0x00260025, 0x00290028, 0x002c002a, 0x0030002e, 0x00340032,
+    0x00360035, 0x00390038, 0x003c003a, 0x0040003e, 0x00440042, 0x00460045,
+    0x00490048, 0x004c004a, 0x0050004e, 0x00540052, 0x00550055, 0x00570056,
+    0x00580058, 0x00590058, 0x005b005a, 0x005b005b, 0x005d005c, 0x005e005e,
+    0x005f005e, 0x00610060, 0x00000061, 0x42200000, 0x42200000, 0x43200000,
+    0x43200000, 0x43700000, 0x43700000, 0x43700000, 0x42200000, 0x42a00000,
+    0x42200000, 0x42a00000, 0x42a00000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000,
+    0x43200000, 0x43200000, 0x42a00000, 0x42a00000, 0x42a00000, 0x43200000,
+    0x43200000, 0x43200000, 0x43200000, 0x43700000, 0x43200000, 0x43700000,
+    0x43200000, 0x43700000, 0x43200000, 0x43200000, 0x42200000, 0x42a00000,
+    0x42200000, 0x42a00000, 0x42a00000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000,
+    0x43200000, 0x43200000, 0x42200000, 0x42a00000, 0x42200000, 0x42a00000,
+    0x42a00000, 0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43700000,
+    0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43200000,
+    0x42200000, 0x42a00000, 0x42200000, 0x42a00000, 0x42a00000, 0x43200000,
+    0x43200000, 0x43200000, 0x43200000, 0x43700000, 0x43200000, 0x43700000,
+    0x43200000, 0x43700000, 0x43200000, 0x43200000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x43700000, 0x43700000, 0x43700000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x43700000, 0x43700000, 0x43700000, 0x42200000, 0x42200000,
+    0x43200000, 0x43200000, 0x43700000, 0x43700000, 0x43700000, 0x42200000,
+    0x43700000, 0x42200000, 0x43700000, 0x43700000, 0x43200000, 0x42a00000,
+    0x43200000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x42a00000, 0x43700000, 0x43700000, 0x43700000,
+    0x43200000, 0x42a00000, 0x43200000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x42a00000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43700000, 0x43200000, 0x42a00000,
+    0x43200000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x42a00000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43700000, 0x43200000, 0x43200000, 0x43200000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43200000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43700000,
+    0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43200000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x80000000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x42200000, 0x42200000, 0x43200000, 0x43200000, 0x43700000,
+    0x43700000, 0x43700000, 0x42200000, 0x43200000, 0x42200000, 0x43200000,
+    0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43700000,
+    0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43200000,
+    0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000,
+    0x43200000, 0x43200000, 0x42200000, 0x43200000, 0x42200000, 0x43200000,
+    0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43700000,
+    0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43200000,
+    0x42200000, 0x43200000, 0x42200000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x43200000, 0x43200000, 0x43700000, 0x43200000, 0x43700000,
+    0x43200000, 0x43700000, 0x43200000, 0x43200000, 0x42200000, 0x43200000,
+    0x42200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000,
+    0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43700000,
+    0x43700000, 0x43700000, 0x43200000, 0x43200000, 0x43200000, 0x43700000,
+    0x43700000, 0x43700000, 0x00500050, 0x010100a0, 0x000000a0, 0x010100a1,
+    0x000000f0, 0x010100f0, 0x005000a0, 0x010000a0, 0x00a000a0, 0x010000a0,
+    0x00780028, 0x01010029, 0x00000028, 0x01010029, 0x00d500bd, 0x0200000a,
+    0x00d600bd, 0x0200000a, 0x00d700bd, 0x0200000a, 0x00d800bd, 0x0200000a,
+    0x00d900bd, 0x0200000a, 0x00da00bd, 0x0200000a, 0x00db00bd, 0x0200000a,
+    0x00dc00bd, 0x0200000a, 0x00dd00bd, 0x0200000a, 0x00de00bd, 0x0200000a};
+
+/* Seed 3, par 4 */
+static const uint32_t course6_blob[] ONCHIP_RODATA = {
+    0x32535243, 0x00b50124, 0x00c8000a, 0x00000000, 0x00f00140, 0x00110007,
+    0x00660028, 0x026400cc, 0x059403fc, 0x08c4072c, 0x00000000, 0x00020001,
+    0x00040003, 0x00060005, 0x00080007, 0x00090008, 0x000d000b, 0x0011000f,
+    0x00150013, 0x00190017, 0x001b001a, 0x001f001d, 0x00230021, 0x00270025,
+    0x002b0029, 0x002d002c, 0x0031002f, 0x00350033, 0x003b0038, 0x003f003d,
+    0x00410040, 0x00450043, 0x00490047, 0x004e004c, 0x0050004f, 0x00510050,
+    0x00550053, 0x00590057, 0x005e005c, 0x0060005f, 0x00600060, 0x00600060,
+    0x00600060, 0x00610060, 0x00630062, 0x00630063, 0x00630063, 0x00630063,
+    0x00640063, 0x00660065, 0x00000066, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x43200000, 0x43200000, 0x43700000, 0x43700000, 0x43700000, 0x00000000,
+    0x42a00000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x00000000,
+    0x43200000, 0x00000000, 0x43200000, 0x00000000, 0x43700000, 0x00000000,
+    0x43700000, 0x00000000, 0x43700000, 0x00000000, 0x00000000, 0x00000000,
+    0x42a00000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x00000000,
+    0x43200000, 0x00000000, 0x43200000, 0x00000000, 0x43700000, 0x00000000,
+    0x43700000, 0x00000000, 0x43700000, 0x00000000, 0x00000000, 0x00000000,
+    0x42a00000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x00000000,
+    0x43200000, 0x00000000, 0x43200000, 0x00000000, 0x43480000, 0x43700000,
+    0x00000000, 0x43480000, 0x43700000, 0x00000000, 0x43700000, 0x00000000,
+    0x00000000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x00000000,
+    0x42a00000, 0x00000000, 0x43200000, 0x00000000, 0x43200000, 0x00000000,
+    0x43480000, 0x43700000, 0x43480000, 0x43700000, 0x43700000, 0x00000000,
+    0x42a00000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x00000000,
+    0x43200000, 0x00000000, 0x43200000, 0x00000000, 0x43480000, 0x43700000,
+    0x43480000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x43200000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x43200000, 0x42a00000, 0x43200000, 0x42a00000, 0x43200000, 0x42a00000,
+    0x43200000, 0x42a00000, 0x43200000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x43200000, 0x42a00000, 0x43200000, 0x42a00000, 0x43200000, 0x42a00000,
+    0x43200000, 0x42a00000, 0x43200000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x43200000, 0x42a00000, 0x43200000, 0x42a00000, 0x43200000, 0x42a00000,
+    0x43200000, 0x42a00000, 0x43200000, 0x42a00000, 0x43200000, 0x42a00000,
+    0x42a00000, 0x43200000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43700000, 0x43200000,
+    0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43700000,
+    0x43200000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x43200000, 0x42a00000, 0x42a00000, 0x42a00000, 0x43a00000,
+    0x43200000, 0x43a00000, 0x43200000, 0x43a00000, 0x43200000, 0x43a00000,
+    0x43200000, 0x43a00000, 0x43200000, 0x43a00000, 0x42a00000, 0x43a00000,
+    0x42a00000, 0x43a00000, 0x42a00000, 0x43a00000, 0x43a00000, 0x43a00000,
+    0x43200000, 0x43a00000, 0x43200000, 0x43a00000, 0x43200000, 0x43a00000,
+    0x43200000, 0x43a00000, 0x43200000, 0x43a00000, 0x42a00000, 0x43a00000,
+    0x42a00000, 0x43a00000, 0x42a00000, 0x43a00000, 0x43a00000, 0x43a00000,
+    0x43200000, 0x43a00000, 0x43200000, 0x43a00000, 0x43200000, 0x43a00000,
+    0x43200000, 0x43a00000, 0x43200000, 0x43a00000, 0x42200000, 0x42a00000,
+    0x43a00000, 0x42200000, 0x42a00000, 0x43a00000, 0x42a00000, 0x43a00000,
+    0x43a00000, 0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000,
+    0x42200000, 0x42a00000, 0x42200000, 0x42a00000, 0x42a00000, 0x43200000,
+    0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x42200000, 0x42a00000,
+    0x42200000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x42a00000, 0x42a00000, 0x00000050, 0x010100a1, 0x000000a0,
+    0x010100a1, 0x000000f0, 0x01010051, 0x00a000f0, 0x01010050, 0x00500000,
+    0x01000140, 0x00a00000, 0x010000a1, 0x007800c8, 0x01010029, 0x00b0011f,
+    0x0200000a, 0x00b1011f, 0x0200000a, 0x00b2011f, 0x0200000a, 0x00b3011f,
+    0x0200000a, 0x00b4011f, 0x0200000a, 0x00b5011f, 0x0200000a, 0x00b6011f,
+    0x0200000a, 0x00b7011f, 0x0200000a, 0x00b8011f, 0x0200000a, 0x00b9011f,
+    0x0200000a};
+
+/* Seed 4, par 3 */
+static const uint32_t course7_blob[] ONCHIP_RODATA = {
+    0x32535243, 0x0022007a, 0x00c8000a, 0x00000000, 0x00f00140, 0x00130009,
+    0x00780028, 0x02ac00cc, 0x066c048c, 0x0a2c084c, 0x00000000, 0x00020001,
+    0x00040003, 0x00060005, 0x00080007, 0x00090008, 0x000d000b, 0x0011000f,
+    0x00150013, 0x00190017, 0x001b001a, 0x001f001d, 0x00230021, 0x00270025,
+    0x002b0029, 0x002d002c, 0x0031002f, 0x00370034, 0x003b0039, 0x003f003d,
+    0x00410040, 0x00450043, 0x004b0048, 0x004f004d, 0x00530051, 0x00550054,
+    0x00590057, 0x0061005d, 0x00650063, 0x00690067, 0x006a006a, 0x006a006a,
+    0x006d006b, 0x006f006e, 0x00710070, 0x00710071, 0x00710071, 0x00740072,
+    0x00760075, 0x00780077, 0x00000078, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x43200000, 0x43200000, 0x43700000, 0x43700000, 0x43700000, 0x00000000,
+    0x42a00000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x00000000,
+    0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43200000, 0x00000000,
+    0x42a00000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x00000000,
+    0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43200000, 0x00000000,
+    0x42a00000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x00000000,
+    0x42f00000, 0x43200000, 0x43200000, 0x42f00000, 0x43200000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43200000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x00000000,
+    0x42a00000, 0x00000000, 0x42f00000, 0x43200000, 0x43200000, 0x42f00000,
+    0x43200000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43200000, 0x00000000, 0x42a00000, 0x00000000,
+    0x42a00000, 0x00000000, 0x42a00000, 0x00000000, 0x42f00000, 0x42f00000,
+    0x43200000, 0x43200000, 0x42f00000, 0x42f00000, 0x43200000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43200000, 0x42f00000, 0x43200000, 0x42f00000, 0x43200000, 0x43700000,
+    0x43700000, 0x43700000, 0x42f00000, 0x43200000, 0x42f00000, 0x43200000,
+    0x43700000, 0x43700000, 0x43700000, 0x43200000, 0x43200000, 0x43200000,
+    0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x42a00000,
+    0x43200000, 0x42a00000, 0x43200000, 0x42a00000, 0x43200000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x43200000, 0x42a00000, 0x43200000, 0x42a00000, 0x43200000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x43200000, 0x42a00000, 0x43200000, 0x42a00000, 0x43200000, 0x42a00000,
+    0x43200000, 0x43700000, 0x42a00000, 0x43200000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x42a00000, 0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x43200000, 0x43200000, 0x43700000, 0x43200000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43200000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x80000000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x80000000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x3f800000, 0x80000000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000,
+    0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x43200000, 0x43200000, 0x43200000,
+    0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x42a00000,
+    0x43200000, 0x42a00000, 0x43200000, 0x42a00000, 0x43200000, 0x42a00000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43200000, 0x42a00000,
+    0x43200000, 0x42a00000, 0x43200000, 0x42a00000, 0x43200000, 0x42a00000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43200000, 0x42a00000,
+    0x43200000, 0x42a00000, 0x43200000, 0x42a00000, 0x43200000, 0x42a00000,
+    0x42200000, 0x43700000, 0x43200000, 0x42200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43200000, 0x42a00000, 0x43200000, 0x42a00000, 0x43200000, 0x42a00000,
+    0x43200000, 0x42a00000, 0x42200000, 0x43700000, 0x43200000, 0x42200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43200000, 0x42a00000, 0x43200000, 0x42a00000,
+    0x43200000, 0x42a00000, 0x43200000, 0x42a00000, 0x42200000, 0x42200000,
+    0x43700000, 0x43200000, 0x42200000, 0x42200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43200000, 0x42200000, 0x43700000, 0x42200000, 0x43700000, 0x43700000,
+    0x43700000, 0x43700000, 0x42200000, 0x43700000, 0x42200000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x00000050, 0x010100a1, 0x000000a0,
+    0x010100f0, 0x000000f0, 0x010100f0, 0x00500000, 0x01000051, 0x005000a0,
+    0x010000a0, 0x00a00000, 0x01000051, 0x00a000a0, 0x010000a0, 0x00c80078,
+    0x01010028, 0x00780078, 0x01010029, 0x001d0075, 0x0200000a, 0x001e0075,
+    0x0200000a, 0x001f0075, 0x0200000a, 0x00200075, 0x0200000a, 0x00210075,
+    0x0200000a, 0x00220075, 0x0200000a, 0x00230075, 0x0200000a, 0x00240075,
+    0x0200000a, 0x00250075, 0x0200000a, 0x00260075, 0x0200000a};
+
+/* Seed 5, par 3 */
+static const uint32_t course8_blob[] ONCHIP_RODATA = {
+    0x32535243, 0x00700106, 0x0028000a, 0x00500000, 0x00f00140, 0x00100006,
+    0x006f0028, 0x028800cc, 0x06000444, 0x097807bc, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00010000, 0x00050003, 0x00090007,
+    0x000d000b, 0x0012000f, 0x00140013, 0x00180016, 0x001c001a, 0x0020001e,
+    0x00250022, 0x00270026, 0x002b0029, 0x002f002d, 0x00330031, 0x00380035,
+    0x003a0039, 0x003e003c, 0x00420040, 0x00460044, 0x004b0048, 0x004e004d,
+    0x00520050, 0x00560054, 0x005a0058, 0x005e005c, 0x005f005f, 0x00610060,
+    0x00630062, 0x00650064, 0x00670066, 0x00670067, 0x00690068, 0x006b006a,
+    0x006d006c, 0x006f006e, 0x0000006f, 0x00000000, 0x42a00000, 0x00000000,
+    0x42a00000, 0x00000000, 0x42a00000, 0x00000000, 0x43200000, 0x00000000,
+    0x43200000, 0x00000000, 0x43700000, 0x00000000, 0x43700000, 0x00000000,
+    0x43700000, 0x00000000, 0x438c0000, 0x438c0000, 0x00000000, 0x42a00000,
+    0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x00000000, 0x43200000,
+    0x00000000, 0x43200000, 0x00000000, 0x43700000, 0x00000000, 0x43700000,
+    0x00000000, 0x43700000, 0x00000000, 0x438c0000, 0x438c0000, 0x00000000,
+    0x42a00000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x00000000,
+    0x43200000, 0x00000000, 0x43200000, 0x00000000, 0x43700000, 0x00000000,
+    0x43700000, 0x00000000, 0x43700000, 0x00000000, 0x438c0000, 0x438c0000,
+    0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000,
+    0x00000000, 0x43200000, 0x00000000, 0x43200000, 0x00000000, 0x43700000,
+    0x00000000, 0x43700000, 0x00000000, 0x43700000, 0x00000000, 0x438c0000,
+    0x00000000, 0x438c0000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000,
+    0x00000000, 0x42a00000, 0x00000000, 0x43200000, 0x00000000, 0x43200000,
+    0x00000000, 0x43700000, 0x00000000, 0x43700000, 0x00000000, 0x43700000,
+    0x00000000, 0x00000000, 0x42a00000, 0x42a00000, 0x42a00000, 0x43200000,
+    0x43200000, 0x43700000, 0x43700000, 0x43700000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x43200000, 0x43200000, 0x43700000, 0x43700000, 0x43700000,
+    0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000,
+    0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000,
+    0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x42f00000,
+    0x42f00000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x42f00000, 0x42f00000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000,
+    0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000,
+    0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000,
+    0x42a00000, 0x42f00000, 0x42f00000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x42f00000, 0x43200000, 0x42f00000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43200000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x80000000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x43700000, 0x43200000, 0x43700000,
+    0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000,
+    0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000,
+    0x43200000, 0x43700000, 0x42200000, 0x42200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x42200000, 0x42200000, 0x43700000,
+    0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000,
+    0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000,
+    0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x42200000, 0x42200000,
+    0x43a00000, 0x43200000, 0x43a00000, 0x43200000, 0x43a00000, 0x43200000,
+    0x43a00000, 0x43200000, 0x43a00000, 0x43200000, 0x43a00000, 0x43200000,
+    0x43a00000, 0x43200000, 0x43a00000, 0x43200000, 0x43a00000, 0x42200000,
+    0x43a00000, 0x42200000, 0x43a00000, 0x43200000, 0x43a00000, 0x43200000,
+    0x43a00000, 0x43200000, 0x43a00000, 0x43200000, 0x43a00000, 0x43200000,
+    0x43a00000, 0x43200000, 0x43a00000, 0x43200000, 0x43a00000, 0x43200000,
+    0x43a00000, 0x43a00000, 0x43200000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000,
+    0x00500050, 0x010100a0, 0x005000a0, 0x010100a0, 0x005000f0, 0x010100a0,
+    0x00500000, 0x010000f1, 0x00a00000, 0x01000140, 0x00500118, 0x01010029,
+    0x006b0101, 0x0200000a, 0x006c0101, 0x0200000a, 0x006d0101, 0x0200000a,
+    0x006e0101, 0x0200000a, 0x006f0101, 0x0200000a, 0x00700101, 0x0200000a,
+    0x00710101, 0x0200000a, 0x00720101, 0x0200000a, 0x00730101, 0x0200000a,
+    0x00740101, 0x0200000a};
+
+/* Seed 6, par 3 */
+static const uint32_t course9_blob[] ONCHIP_RODATA = {
+    0x32535243, 0x002e00d3, 0x0078000a, 0x00000000, 0x00f00140, 0x00110007,
+    0x00700028, 0x028c00cc, 0x060c044c, 0x098c07cc, 0x00000000, 0x00020001,
+    0x00030003, 0x00040003, 0x00060005, 0x00070006, 0x000b0009, 0x000f000d,
+    0x00130011, 0x00170015, 0x00190018, 0x001d001b, 0x0021001f, 0x00250023,
+    0x00290027, 0x002b002a, 0x002f002d, 0x00330031, 0x00370035, 0x003b0039,
+    0x003d003c, 0x0041003f, 0x00450043, 0x00490047, 0x004d004b, 0x004f004e,
+    0x00530051, 0x00570055, 0x005b0059, 0x005f005d, 0x00600060, 0x00620061,
+    0x00640063, 0x00660065, 0x00680067, 0x00680068, 0x006a0069, 0x006c006b,
+    0x006e006d, 0x0070006f, 0x00000070, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x43700000, 0x43700000, 0x43700000, 0x00000000, 0x42a00000, 0x00000000,
+    0x42a00000, 0x00000000, 0x42a00000, 0x00000000, 0x43200000, 0x43200000,
+    0x43200000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43200000, 0x00000000, 0x42a00000, 0x00000000,
+    0x42a00000, 0x00000000, 0x42a00000, 0x00000000, 0x43200000, 0x43200000,
+    0x43200000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43200000, 0x00000000, 0x42a00000, 0x00000000,
+    0x42a00000, 0x00000000, 0x42a00000, 0x00000000, 0x43200000, 0x43200000,
+    0x43200000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43200000, 0x00000000, 0x42a00000, 0x00000000,
+    0x42a00000, 0x00000000, 0x42a00000, 0x00000000, 0x43200000, 0x00000000,
+    0x43200000, 0x00000000, 0x43700000, 0x00000000, 0x43700000, 0x00000000,
+    0x43700000, 0x00000000, 0x00000000, 0x00000000, 0x42a00000, 0x00000000,
+    0x42a00000, 0x00000000, 0x42a00000, 0x00000000, 0x43200000, 0x00000000,
+    0x43200000, 0x00000000, 0x43700000, 0x00000000, 0x43700000, 0x00000000,
+    0x43700000, 0x00000000, 0x00000000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x43200000, 0x43200000, 0x43700000, 0x43700000, 0x43700000, 0x42a00000,
+    0x42a00000, 0x42a00000, 0x43200000, 0x43200000, 0x43700000, 0x43700000,
+    0x43700000, 0x42a00000, 0x42a00000, 0x42a00000, 0x43700000, 0x43700000,
+    0x43700000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x42a00000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43200000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43200000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x42a00000, 0x42a00000, 0x42a00000, 0x43700000, 0x43700000,
+    0x43700000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x42a00000, 0x43200000, 0x43200000, 0x43200000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43200000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x42a00000, 0x43200000, 0x43200000, 0x43200000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43200000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x42a00000, 0x43200000, 0x43200000, 0x43200000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43200000, 0x43a00000, 0x42a00000, 0x43a00000, 0x42a00000, 0x43a00000,
+    0x42a00000, 0x43a00000, 0x43200000, 0x43a00000, 0x43200000, 0x43a00000,
+    0x43700000, 0x43a00000, 0x43700000, 0x43a00000, 0x43700000, 0x43a00000,
+    0x43a00000, 0x43a00000, 0x42a00000, 0x43a00000, 0x42a00000, 0x43a00000,
+    0x42a00000, 0x43a00000, 0x43200000, 0x43a00000, 0x43200000, 0x43a00000,
+    0x43700000, 0x43a00000, 0x43700000, 0x43a00000, 0x43700000, 0x43a00000,
+    0x43a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x43200000, 0x43200000,
+    0x43700000, 0x43700000, 0x43700000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x43200000, 0x43200000, 0x43700000, 0x43700000, 0x43700000, 0x00000050,
+    0x01010051, 0x00a00050, 0x01010050, 0x005000a0, 0x010100a0, 0x000000f0,
+    0x010100f0, 0x00500000, 0x01000051, 0x005000a0, 0x010000a0, 0x00a00000,
+    0x01000140, 0x002900ce, 0x0200000a, 0x002a00ce, 0x0200000a, 0x002b00ce,
+    0x0200000a, 0x002c00ce, 0x0200000a, 0x002d00ce, 0x0200000a, 0x002e00ce,
+    0x0200000a, 0x002f00ce, 0x0200000a, 0x003000ce, 0x0200000a, 0x003100ce,
+    0x0200000a, 0x003200ce, 0x0200000a};
+
+/* Seed 7, par 2 */
+static const uint32_t course10_blob[] ONCHIP_RODATA = {
+    0x32535243, 0x0026008b, 0x0078000a, 0x00000000, 0x00f00140, 0x00120008,
+    0x007a0028, 0x02b400cc, 0x0684049c, 0x0a54086c, 0x00000000, 0x00020001,
+    0x00060004, 0x00080007, 0x000a0009, 0x000b000a, 0x000f000d, 0x00150012,
+    0x00190017, 0x001d001b, 0x001f001e, 0x00230021, 0x00290026, 0x002d002b,
+    0x0031002f, 0x00330032, 0x00370035, 0x003d003a, 0x0041003f, 0x00450043,
+    0x00470046, 0x004b0049, 0x004f004d, 0x00530051, 0x00570055, 0x00590058,
+    0x005d005b, 0x0061005f, 0x00650063, 0x00690067, 0x006a006a, 0x006c006b,
+    0x006e006d, 0x0070006f, 0x00720071, 0x00720072, 0x00740073, 0x00760075,
+    0x00780077, 0x007a0079, 0x0000007a, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x42f00000, 0x43200000, 0x42f00000, 0x43200000, 0x43700000, 0x43700000,
+    0x43700000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x00000000,
+    0x42a00000, 0x00000000, 0x42f00000, 0x43200000, 0x43200000, 0x42f00000,
+    0x43200000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43200000, 0x00000000, 0x42a00000, 0x00000000,
+    0x42a00000, 0x00000000, 0x42a00000, 0x00000000, 0x42f00000, 0x43200000,
+    0x43200000, 0x42f00000, 0x43200000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43200000, 0x00000000,
+    0x42a00000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x00000000,
+    0x42f00000, 0x43200000, 0x43200000, 0x42f00000, 0x43200000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43200000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x00000000,
+    0x42a00000, 0x00000000, 0x43200000, 0x00000000, 0x43200000, 0x00000000,
+    0x43700000, 0x00000000, 0x43700000, 0x00000000, 0x43700000, 0x00000000,
+    0x00000000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x00000000,
+    0x42a00000, 0x00000000, 0x43200000, 0x00000000, 0x43200000, 0x00000000,
+    0x43700000, 0x00000000, 0x43700000, 0x00000000, 0x43700000, 0x00000000,
+    0x00000000, 0x42a00000, 0x42a00000, 0x42a00000, 0x43200000, 0x43200000,
+    0x43700000, 0x43700000, 0x43700000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x43200000, 0x43200000, 0x43700000, 0x43700000, 0x43700000, 0x42a00000,
+    0x42a00000, 0x42a00000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x43700000,
+    0x42a00000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x43700000, 0x42a00000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x42a00000, 0x42a00000, 0x43700000, 0x42a00000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x42a00000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43200000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43200000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x80000000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x3f800000, 0x80000000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x42a00000,
+    0x42a00000, 0x42a00000, 0x42200000, 0x43700000, 0x42200000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42200000, 0x43700000,
+    0x43200000, 0x42200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43200000, 0x42a00000,
+    0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x42200000, 0x43700000, 0x43200000, 0x42200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43200000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x42a00000, 0x42200000, 0x43700000, 0x43200000, 0x42200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43200000, 0x43a00000, 0x42a00000, 0x43a00000,
+    0x42a00000, 0x43a00000, 0x42a00000, 0x43a00000, 0x43700000, 0x43a00000,
+    0x43700000, 0x43a00000, 0x43700000, 0x43a00000, 0x43700000, 0x43a00000,
+    0x43700000, 0x43a00000, 0x43a00000, 0x43a00000, 0x42a00000, 0x43a00000,
+    0x42a00000, 0x43a00000, 0x42a00000, 0x43a00000, 0x43700000, 0x43a00000,
+    0x43700000, 0x43a00000, 0x43700000, 0x43a00000, 0x43700000, 0x43a00000,
+    0x43700000, 0x43a00000, 0x43a00000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x42a00000,
+    0x42a00000, 0x42a00000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x00000050, 0x01010051, 0x00a00050, 0x01010050, 0x000000a0,
+    0x010100f0, 0x000000f0, 0x010100f0, 0x00500000, 0x01000051, 0x005000a0,
+    0x010000a0, 0x00a00000, 0x01000140, 0x00280078, 0x01010029, 0x00210086,
+    0x0200000a, 0x00220086, 0x0200000a, 0x00230086, 0x0200000a, 0x00240086,
+    0x0200000a, 0x00250086, 0x0200000a, 0x00260086, 0x0200000a, 0x00270086,
+    0x0200000a, 0x00280086, 0x0200000a, 0x00290086, 0x0200000a, 0x002a0086,
+    0x0200000a};
+
+/* Seed 8, par 3 */
+static const uint32_t course11_blob[] ONCHIP_RODATA = {
+    0x32535243, 0x007b00d4, 0x0028000a, 0x00000000, 0x00f00140, 0x00130009,
+    0x007d0028, 0x02c000cc, 0x06a804b4, 0x0a90089c, 0x00000000, 0x00000000,
+    0x00010000, 0x00030002, 0x00050004, 0x00060005, 0x000a0008, 0x000e000c,
+    0x00140011, 0x00180016, 0x001a0019, 0x001e001c, 0x00220020, 0x00280025,
+    0x002c002a, 0x002e002d, 0x00320030, 0x00380035, 0x003e003b, 0x00420040,
+    0x00440043, 0x00480046, 0x004e004b, 0x00540051, 0x00580056, 0x005a0059,
+    0x005e005c, 0x00640061, 0x00680066, 0x006c006a, 0x006d006d, 0x006f006e,
+    0x00710070, 0x00730072, 0x00750074, 0x00750075, 0x00770076, 0x00790078,
+    0x007b007a, 0x007d007c, 0x0000007d, 0x43200000, 0x43200000, 0x43700000,
+    0x43700000, 0x43700000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000,
+    0x00000000, 0x42a00000, 0x00000000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x43480000, 0x43700000, 0x43200000, 0x43480000, 0x43700000,
+    0x43200000, 0x43700000, 0x43200000, 0x43200000, 0x00000000, 0x42a00000,
+    0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x00000000, 0x43200000,
+    0x43200000, 0x43200000, 0x43200000, 0x43480000, 0x43700000, 0x43200000,
+    0x43480000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43200000,
+    0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000,
+    0x00000000, 0x42f00000, 0x43200000, 0x43200000, 0x42f00000, 0x43200000,
+    0x43200000, 0x43480000, 0x43700000, 0x43200000, 0x43480000, 0x43700000,
+    0x43200000, 0x43700000, 0x43200000, 0x43200000, 0x00000000, 0x42a00000,
+    0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x00000000, 0x42f00000,
+    0x43200000, 0x00000000, 0x42f00000, 0x43200000, 0x00000000, 0x43480000,
+    0x43700000, 0x00000000, 0x43480000, 0x43700000, 0x00000000, 0x43700000,
+    0x00000000, 0x00000000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000,
+    0x00000000, 0x42a00000, 0x00000000, 0x42f00000, 0x43200000, 0x00000000,
+    0x42f00000, 0x43200000, 0x00000000, 0x43700000, 0x00000000, 0x43700000,
+    0x00000000, 0x43700000, 0x00000000, 0x00000000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x43200000, 0x43200000, 0x43700000, 0x43700000, 0x43700000,
+    0x42a00000, 0x42a00000, 0x42a00000, 0x43200000, 0x43200000, 0x43700000,
+    0x43700000, 0x43700000, 0x42a00000, 0x42a00000, 0x43700000, 0x43700000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x42f00000, 0x43700000, 0x42a00000, 0x42f00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x42a00000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x42a00000, 0x42a00000, 0x42f00000, 0x43700000, 0x42a00000, 0x42f00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43200000, 0x42a00000, 0x42a00000, 0x43200000, 0x42a00000, 0x42a00000,
+    0x42f00000, 0x43700000, 0x42a00000, 0x42f00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x42a00000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43200000, 0x43700000,
+    0x43200000, 0x43200000, 0x43700000, 0x43200000, 0x42f00000, 0x43700000,
+    0x43200000, 0x42f00000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43200000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43200000, 0x43700000, 0x43200000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43200000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x80000000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x3f800000, 0x80000000,
+    0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x3f800000, 0x80000000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x42a00000,
+    0x42a00000, 0x43700000, 0x43700000, 0x43700000, 0x42a00000, 0x43200000,
+    0x42a00000, 0x43200000, 0x42a00000, 0x43200000, 0x42a00000, 0x42a00000,
+    0x43200000, 0x42a00000, 0x43200000, 0x42200000, 0x43700000, 0x43200000,
+    0x42200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43200000,
+    0x42a00000, 0x43200000, 0x42a00000, 0x43200000, 0x42a00000, 0x43200000,
+    0x42a00000, 0x42a00000, 0x43200000, 0x42a00000, 0x43200000, 0x42200000,
+    0x43700000, 0x43200000, 0x42200000, 0x43700000, 0x43200000, 0x43700000,
+    0x43200000, 0x43200000, 0x42a00000, 0x43200000, 0x42a00000, 0x43200000,
+    0x42a00000, 0x43200000, 0x42a00000, 0x42200000, 0x42a00000, 0x43200000,
+    0x42200000, 0x42a00000, 0x43200000, 0x42200000, 0x43700000, 0x43200000,
+    0x42200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43200000,
+    0x43a00000, 0x43200000, 0x43a00000, 0x43200000, 0x43a00000, 0x43200000,
+    0x43a00000, 0x42200000, 0x42a00000, 0x43a00000, 0x42200000, 0x42a00000,
+    0x43a00000, 0x42200000, 0x43700000, 0x43a00000, 0x42200000, 0x43700000,
+    0x43a00000, 0x43700000, 0x43a00000, 0x43a00000, 0x43a00000, 0x43200000,
+    0x43a00000, 0x43200000, 0x43a00000, 0x43200000, 0x43a00000, 0x42200000,
+    0x42a00000, 0x43a00000, 0x42200000, 0x42a00000, 0x43a00000, 0x43700000,
+    0x43a00000, 0x43700000, 0x43a00000, 0x43700000, 0x43a00000, 0x43a00000,
+    0x43200000, 0x43200000, 0x43200000, 0x42a00000, 0x42a00000, 0x43700000,
+    0x43700000, 0x43700000, 0x43200000, 0x43200000, 0x43200000, 0x42a00000,
+    0x42a00000, 0x43700000, 0x43700000, 0x43700000, 0x00500050, 0x010100a0,
+    0x000000a0, 0x01010051, 0x00a000a0, 0x01010050, 0x000000f0, 0x010100f0,
+    0x00500000, 0x01000051, 0x005000a0, 0x010000a0, 0x00a00000, 0x01000140,
+    0x00780078, 0x01010029, 0x005000c8, 0x01010029, 0x007600cf, 0x0200000a,
+    0x007700cf, 0x0200000a, 0x007800cf, 0x0200000a, 0x007900cf, 0x0200000a,
+    0x007a00cf, 0x0200000a, 0x007b00cf, 0x0200000a, 0x007c00cf, 0x0200000a,
+    0x007d00cf, 0x0200000a, 0x007e00cf, 0x0200000a, 0x007f00cf, 0x0200000a};
+
+/* Seed 9, par 3 */
+static const uint32_t course12_blob[] ONCHIP_RODATA = {
+    0x32535243, 0x0035010d, 0x0028000a, 0x00000000, 0x00f00140, 0x00100006,
+    0x006e0028, 0x028400cc, 0x05f4043c, 0x096407ac, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00010000, 0x00030002, 0x00070005, 0x000b0009,
+    0x000f000d, 0x00140011, 0x00170016, 0x001b0019, 0x001f001d, 0x00230021,
+    0x00270025, 0x00290028, 0x002d002b, 0x0031002f, 0x00350033, 0x00390037,
+    0x003b003a, 0x003f003d, 0x00430041, 0x00470045, 0x004b0049, 0x004d004c,
+    0x0051004f, 0x00550053, 0x00590057, 0x005d005b, 0x005e005e, 0x0060005f,
+    0x00620061, 0x00640063, 0x00660065, 0x00660066, 0x00680067, 0x006a0069,
+    0x006c006b, 0x006e006d, 0x0000006e, 0x438c0000, 0x438c0000, 0x00000000,
+    0x42a00000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x00000000,
+    0x43200000, 0x00000000, 0x43200000, 0x00000000, 0x43700000, 0x00000000,
+    0x43700000, 0x00000000, 0x43700000, 0x00000000, 0x438c0000, 0x00000000,
+    0x438c0000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x00000000,
+    0x42a00000, 0x00000000, 0x43200000, 0x00000000, 0x43200000, 0x00000000,
+    0x43700000, 0x00000000, 0x43700000, 0x00000000, 0x43700000, 0x00000000,
+    0x00000000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x00000000,
+    0x42a00000, 0x00000000, 0x43200000, 0x00000000, 0x43200000, 0x00000000,
+    0x43700000, 0x00000000, 0x43700000, 0x00000000, 0x43700000, 0x00000000,
+    0x00000000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x00000000,
+    0x42a00000, 0x00000000, 0x43200000, 0x00000000, 0x43200000, 0x00000000,
+    0x43700000, 0x00000000, 0x43700000, 0x00000000, 0x43700000, 0x00000000,
+    0x00000000, 0x00000000, 0x42a00000, 0x00000000, 0x42a00000, 0x00000000,
+    0x42a00000, 0x00000000, 0x43200000, 0x00000000, 0x43200000, 0x00000000,
+    0x43700000, 0x00000000, 0x43700000, 0x00000000, 0x43700000, 0x00000000,
+    0x00000000, 0x42a00000, 0x42a00000, 0x42a00000, 0x43200000, 0x43200000,
+    0x43700000, 0x43700000, 0x43700000, 0x42a00000, 0x42a00000, 0x42a00000,
+    0x43200000, 0x43200000, 0x43700000, 0x43700000, 0x43700000, 0x42200000,
+    0x42200000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x42200000, 0x42a00000, 0x42200000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x42a00000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x43700000, 0x42a00000, 0x43700000, 0x42a00000,
+    0x43700000, 0x42a00000, 0x42a00000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43200000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43700000, 0x43200000, 0x43700000, 0x43200000,
+    0x43700000, 0x43200000, 0x43200000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000, 0x43700000,
+    0x43700000, 0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000,
+    0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x3f800000, 0x80000000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x80000000, 0x3f800000, 0x80000000, 0x3f800000, 0x80000000, 0x3f800000,
+    0x3f800000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000,
+    0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x80000000, 0x42200000,
+    0x42200000, 0x43a00000, 0x43200000, 0x43a00000, 0x43200000, 0x43a00000,
+    0x43200000, 0x43a00000, 0x43200000, 0x43a00000, 0x43200000, 0x43a00000,
+    0x43200000, 0x43a00000, 0x43200000, 0x43a00000, 0x43200000, 0x43a00000,
+    0x42200000, 0x43a00000, 0x42200000, 0x43a00000, 0x43200000, 0x43a00000,
+    0x43200000, 0x43a00000, 0x43200000, 0x43a00000, 0x43200000, 0x43a00000,
+    0x43200000, 0x43a00000, 0x43200000, 0x43a00000, 0x43200000, 0x43a00000,
+    0x43200000, 0x43a00000, 0x43a00000, 0x43a00000, 0x43200000, 0x43a00000,
+    0x43200000, 0x43a00000, 0x43200000, 0x43a00000, 0x43200000, 0x43a00000,
+    0x43200000, 0x43a00000, 0x43200000, 0x43a00000, 0x43200000, 0x43a00000,
+    0x43200000, 0x43a00000, 0x43a00000, 0x43a00000, 0x43200000, 0x43a00000,
+    0x43200000, 0x43a00000, 0x43200000, 0x43a00000, 0x43200000, 0x43a00000,
+    0x43200000, 0x43a00000, 0x43200000, 0x43a00000, 0x43200000, 0x43a00000,
+    0x43200000, 0x43a00000, 0x43a00000, 0x43a00000, 0x43200000, 0x43a00000,
+    0x43200000, 0x43a00000, 0x43200000, 0x43a00000, 0x43200000, 0x43a00000,
+    0x43200000, 0x43a00000, 0x43200000, 0x43a00000, 0x43200000, 0x43a00000,
+    0x43200000, 0x43a00000, 0x43a00000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000, 0x43200000,
+    0x43200000, 0x00500050, 0x010100a0, 0x005000a0, 0x010100a0, 0x005000f0,
+    0x010100a0, 0x00500000, 0x01000140, 0x00a00000, 0x01000140, 0x00000118,
+    0x01010029, 0x00300108, 0x0200000a, 0x00310108, 0x0200000a, 0x00320108,
+    0x0200000a, 0x00330108, 0x0200000a, 0x00340108, 0x0200000a, 0x00350108,
+    0x0200000a, 0x00360108, 0x0200000a, 0x00370108, 0x0200000a, 0x00380108,
+    0x0200000a, 0x00390108, 0x0200000a};
+
+static const uint32_t *const course_blobs[] = {
+    course0_blob, course1_blob, course2_blob, course3_blob,
+    course4_blob, course5_blob, course6_blob, course7_blob,
+    course8_blob, course9_blob, course10_blob, course11_blob,
+    course12_blob};
@@ -0,0 +1,1981 @@
+/* Generated by tools/shot_solver -H, do not edit.
+ * Best shot from each 8x8 pixel cell, see HINT_STROKES(). */
+static const uint16_t hint_table[COURSE_COUNT][HINT_ROWS][HINT_COLS]
+    ONCHIP_RODATA = {
+    {
+        {0x8064, 0x8064, 0x805a, 0x805a, 0x8052, 0x8052, 0x8050, 0x8046,
+         0x8046, 0x803e, 0x803c, 0x8032, 0x802a, 0x8028, 0x6064, 0x6064,
+         0x605a, 0x6563, 0x6563, 0x6563, 0x6563, 0x6563, 0x6563, 0x6563,
+         0x6563, 0x6563, 0x6563, 0x6563, 0x6563, 0x6563, 0x6563, 0x44df,
+         0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df},
+        {0x8064, 0x805a, 0x9de3, 0x9de3, 0x9dda, 0x9dda, 0x9dd8, 0x9d52,
+         0x9d52, 0x9d47, 0x9d47, 0x9cc2, 0x9c3a, 0x9c3a, 0x615e, 0x6064,
+         0x64df, 0x64df, 0x64df, 0x64df, 0x64df, 0x64df, 0x64df, 0x64df,
+         0x64df, 0x64df, 0x64df, 0x64df, 0x64df, 0x64df, 0x64df, 0x64df,
+         0x44e0, 0x44e0, 0x44e0, 0x44e0, 0x44e0, 0x44e0, 0x44e0, 0x44e0},
+        {0x8064, 0x9e5f, 0x9de3, 0x9de3, 0x9d5e, 0x9ce4, 0x9cda, 0x9cd9,
+         0x9c56, 0x9c54, 0x9bcf, 0x9bc2, 0x6064, 0x6064, 0x605a, 0x605a,
+         0x64df, 0x64df, 0x64df, 0x64df, 0x64df, 0x64df, 0x64df, 0x64df,
+         0x64df, 0x64df, 0x64df, 0x64df, 0x64df, 0x445f, 0x445f, 0x445e,
+         0x445e, 0x445e, 0x445e, 0x445e, 0x445e, 0x445e, 0x445e, 0x445e},
+        {0x805a, 0x9de3, 0x9de3, 0x9dda, 0x9d5e, 0x9d5d, 0x9c62, 0x9c61,
+         0x9bde, 0x9bdd, 0x9b5b, 0x9b4b, 0x615e, 0x6064, 0x645f, 0x645f,
+         0x645e, 0x645e, 0x645e, 0x645e, 0x645e, 0x645e, 0x645e, 0x645e,
+         0x645e, 0x645e, 0x645e, 0x645e, 0x645e, 0x645e, 0x4460, 0x4460,
+         0x445c, 0x445c, 0x445c, 0x445c, 0x445c, 0x445c, 0x445c, 0x445c},
+        {0x9de4, 0x9de3, 0x9de3, 0x9d5e, 0x9d5e, 0x9d54, 0x9c62, 0x9c61,
+         0x9b62, 0x9ada, 0x6064, 0x6064, 0x605a, 0x605a, 0x645f, 0x645f,
+         0x645e, 0x645c, 0x645c, 0x645c, 0x645c, 0x645c, 0x645c, 0x645c,
+         0x645c, 0x645c, 0x645c, 0x43e2, 0x43e2, 0x43da, 0x43da, 0x43da,
+         0x43da, 0x43da, 0x43da, 0x43da, 0x43da, 0x43da, 0x444e, 0x444e},
+        {0x9de3, 0x9dda, 0x9dda, 0x9d5d, 0x9d52, 0x9cd8, 0x9cd8, 0x9c62,
+         0x9bde, 0x9bde, 0x6064, 0x6064, 0x63e2, 0x63e2, 0x63da, 0x63da,
+         0x63da, 0x63da, 0x63da, 0x63da, 0x63da, 0x63da, 0x63da, 0x63da,
+         0x63da, 0x63da, 0x63da, 0x435a, 0x435a, 0x4357, 0x4357, 0x4357,
+         0x4357, 0x4357, 0x4357, 0x4357, 0x4357, 0x4357, 0x43ca, 0x43ca},
+        {0x9de3, 0x9d5e, 0x9d5e, 0x9d54, 0x9d52, 0x9cd8, 0x9cce, 0x9c61,
+         0x9bde, 0x615e, 0x615e, 0x6064, 0x635a, 0x635a, 0x6357, 0x6357,
+         0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357,
+         0x6357, 0x6357, 0x6357, 0x6357, 0x435c, 0x435c, 0x4358, 0x4358,
+         0x4358, 0x4358, 0x4358, 0x4358, 0x4358, 0x4358, 0x4358, 0x43cc},
+        {0x9dda, 0x9d5d, 0x9d52, 0x9cd8, 0x9cd8, 0x9ccc, 0x9c56, 0x6064,
+         0x6064, 0x605a, 0x605a, 0x6052, 0x635a, 0x635a, 0x6357, 0x6357,
+         0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357,
+         0x42de, 0x42de, 0x42de, 0x42d6, 0x42d5, 0x42d5, 0x42d5, 0x42d5,
+         0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x4345, 0x4345, 0x4345},
+        {0x9d5e, 0x9d5d, 0x9d52, 0x9cd8, 0x9cce, 0x9c61, 0x6064, 0x6064,
+         0x605a, 0x62de, 0x62de, 0x62de, 0x62d6, 0x62d5, 0x62d5, 0x62d5,
+         0x62d5, 0x62d5, 0x62d5, 0x62d5, 0x62d5, 0x62d5, 0x62d5, 0x4264,
+         0x425a, 0x425a, 0x4259, 0x4253, 0x4253, 0x4253, 0x4253, 0x4253,
+         0x4253, 0x4253, 0x4253, 0x4253, 0x4254, 0x42c0, 0x42c0, 0x42c0},
+        {0x9d54, 0x9ce4, 0x9cda, 0x84df, 0x84df, 0x6064, 0x6064, 0x605a,
+         0x6264, 0x625a, 0x625a, 0x6259, 0x6253, 0x6253, 0x6253, 0x6253,
+         0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x415e, 0x415e,
+         0x4153, 0x4153, 0x4153, 0x4152, 0x4152, 0x4152, 0x4152, 0x4152,
+         0x4152, 0x4152, 0x4152, 0x4152, 0x41b2, 0x41b2, 0x41b2, 0x41b2},
+        {0x83da, 0x83da, 0x83da, 0x6064, 0x6064, 0x605a, 0x605a, 0x615e,
+         0x615e, 0x6153, 0x6153, 0x6153, 0x6152, 0x6152, 0x6152, 0x6152,
+         0x6152, 0x6152, 0x6152, 0x6152, 0x4064, 0x4064, 0x405a, 0x405a,
+         0x4052, 0x4052, 0x4050, 0x4046, 0x4046, 0x403e, 0x403c, 0x4032,
+         0x402a, 0x4028, 0x401e, 0x4014, 0x4006, 0x2663, 0x26df, 0x275e},
+        {0x82d5, 0x82d5, 0x82d5, 0x82d5, 0x82d5, 0x6064, 0x6064, 0x605a,
+         0x605a, 0x6052, 0x6052, 0x6050, 0x6046, 0x6046, 0x603e, 0x603c,
+         0x6032, 0x602a, 0x6028, 0x601e, 0x6014, 0x6006, 0x5e5f, 0x5de4,
+         0x42de, 0x42de, 0x42de, 0x42d6, 0x42d5, 0x42d5, 0x42d5, 0x42d5,
+         0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x4345, 0x4345, 0x4345},
+        {0x63e2, 0x62de, 0x62de, 0x62de, 0x62d6, 0x62d6, 0x62d6, 0x60db,
+         0x60db, 0x60d2, 0x60d2, 0x60d2, 0x60d2, 0x4064, 0x4064, 0x405a,
+         0x405a, 0x4052, 0x4052, 0x4050, 0x4046, 0x4046, 0x403e, 0x403c,
+         0x4032, 0x402a, 0x42e0, 0x42e0, 0x42d5, 0x23e2, 0x23e2, 0x23da,
+         0x23da, 0x2452, 0x2452, 0x244e, 0x24c6, 0x2542, 0x25bb, 0x263a},
+        {0x615e, 0x615e, 0x6153, 0x6153, 0x6153, 0x6152, 0x6152, 0x6152,
+         0x6152, 0x6152, 0x6152, 0x6152, 0x6152, 0x4064, 0x4064, 0x405a,
+         0x405a, 0x4052, 0x4052, 0x4050, 0x4046, 0x4046, 0x403e, 0x403c,
+         0x4032, 0x402a, 0x4028, 0x401e, 0x4014, 0x4006, 0x23e4, 0x23e2,
+         0x23d9, 0x23d9, 0x23da, 0x244e, 0x2450, 0x24c8, 0x2540, 0x25bc},
+        {0x605a, 0x605a, 0x6052, 0x6052, 0x6050, 0x6046, 0x6046, 0x603e,
+         0x603c, 0x6032, 0x602a, 0x42de, 0x4064, 0x4064, 0x405a, 0x5de3,
+         0x5de3, 0x5d5e, 0x5d5e, 0x5d5d, 0x5d52, 0x5cd8, 0x5cce, 0x5ccc,
+         0x5c47, 0x5c3a, 0x5bc1, 0x5bb3, 0x5b2c, 0x235a, 0x235a, 0x2357,
+         0x2357, 0x2357, 0x2357, 0x23d9, 0x2442, 0x2440, 0x24b9, 0x2534},
+        {0x7e5f, 0x7de4, 0x7de4, 0x7de4, 0x7dd8, 0x7cda, 0x7c61, 0x7c56,
+         0x7bdd, 0x7bcf, 0x4064, 0x4064, 0x405a, 0x405a, 0x5e5f, 0x5de3,
+         0x5de3, 0x5d5e, 0x5d5e, 0x5cda, 0x5c61, 0x5c56, 0x5bdd, 0x5bcf,
+         0x5bc2, 0x5b4c, 0x5ac8, 0x22de, 0x22de, 0x22d6, 0x22d6, 0x22d6,
+         0x22d6, 0x22d6, 0x22d6, 0x2346, 0x23ba, 0x23ba, 0x24b9, 0x2534},
+        {0x7de3, 0x7de3, 0x7dda, 0x7dd8, 0x7d5d, 0x7c62, 0x7bde, 0x7bde,
+         0x7b5b, 0x415e, 0x4064, 0x4064, 0x5e5f, 0x5de4, 0x5de3, 0x5de3,
+         0x5dd8, 0x5d5e, 0x5d54, 0x5bde, 0x5bde, 0x5b5b, 0x5b56, 0x5ad9,
+         0x5a58, 0x59d8, 0x5942, 0x225a, 0x225a, 0x2253, 0x2253, 0x2253,
+         0x2253, 0x2253, 0x2253, 0x2253, 0x22c2, 0x2333, 0x23da, 0x24ac},
+        {0x7de3, 0x7dd8, 0x7d5e, 0x7d54, 0x7d52, 0x7cd8, 0x7bde, 0x4064,
+         0x4064, 0x405a, 0x405a, 0x4052, 0x5de3, 0x5de3, 0x5dda, 0x5dda,
+         0x5d5d, 0x5d52, 0x5cd8, 0x5bde, 0x5bde, 0x5b5b, 0x5ada, 0x5ad9,
+         0x21e2, 0x21e2, 0x21e0, 0x21d6, 0x21d5, 0x21d2, 0x21d2, 0x21d2,
+         0x21d2, 0x21d2, 0x21d2, 0x21d2, 0x21d2, 0x21d2, 0x223a, 0x22d6},
+        {0x7dda, 0x7d5d, 0x7d52, 0x7cd8, 0x7cd8, 0x7ccc, 0x4064, 0x4064,
+         0x405a, 0x5e5f, 0x5de4, 0x5de4, 0x5de3, 0x5dd8, 0x5d5e, 0x5d54,
+         0x5d54, 0x5d48, 0x5cd8, 0x5cc0, 0x5c62, 0x5b62, 0x59e4, 0x2064,
+         0x205a, 0x205a, 0x205a, 0x2052, 0x2050, 0x2046, 0x2046, 0x203e,
+         0x203c, 0x2032, 0x2032, 0x202a, 0x201e, 0x2016, 0x200a, 0x2002},
+        {0x7d54, 0x7d54, 0x7d48, 0x7cd8, 0x7cc0, 0x7cb4, 0x7c2d, 0x4064,
+         0x5e5f, 0x5de3, 0x5de3, 0x5dda, 0x5dd8, 0x5d5d, 0x5d52, 0x5cd8,
+         0x5cd8, 0x5ccc, 0x5cc0, 0x5c3a, 0x5bc1, 0x4663, 0x4663, 0x4663,
+         0x3e5f, 0x3e5f, 0x3e5f, 0x3e56, 0x3e55, 0x3dce, 0x3dce, 0x3dc3,
+         0x3dc3, 0x3d3e, 0x3d3c, 0x3d32, 0x3caa, 0x2663, 0x26df, 0x275e},
+        {0x7164, 0x7164, 0x7162, 0x6563, 0x6563, 0x6563, 0x6563, 0x4064,
+         0x5de3, 0x5de3, 0x5dda, 0x5d5e, 0x5d5d, 0x5d52, 0x5cd8, 0x5cd8,
+         0x5ccc, 0x5cc2, 0x5c3a, 0x4563, 0x4563, 0x4563, 0x4563, 0x4563,
+         0x3de3, 0x3de3, 0x3de3, 0x3dda, 0x3dd8, 0x3d52, 0x3d52, 0x3d47,
+         0x3d47, 0x3cc2, 0x3cc0, 0x3c3a, 0x3bc1, 0x2663, 0x2664, 0x26e0},
+        {0x7164, 0x7164, 0x64df, 0x64df, 0x64df, 0x64df, 0x64df, 0x64df,
+         0x64df, 0x5de3, 0x5d5e, 0x5d5e, 0x5d5e, 0x5ce4, 0x5cda, 0x5cce,
+         0x5c56, 0x5c47, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df,
+         0x44df, 0x44df, 0x44df, 0x3d5e, 0x3d5d, 0x3d5a, 0x3cd8, 0x3cce,
+         0x3ccc, 0x3c47, 0x3c47, 0x2563, 0x25de, 0x265b, 0x265a, 0x26d6},
+        {0x7cce, 0x645f, 0x645f, 0x645e, 0x645e, 0x645e, 0x645e, 0x645e,
+         0x645e, 0x5de3, 0x5de3, 0x5d5e, 0x5ce4, 0x5cda, 0x5cd9, 0x5c56,
+         0x5c54, 0x5bcf, 0x44df, 0x445f, 0x445f, 0x445e, 0x445e, 0x445e,
+         0x445e, 0x445e, 0x445e, 0x3d5e, 0x3ce4, 0x3ce4, 0x3cd9, 0x3cce,
+         0x3c54, 0x3c47, 0x3bcf, 0x2563, 0x2564, 0x25dd, 0x265a, 0x2658},
+        {0x635a, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357,
+         0x6357, 0x6357, 0x6357, 0x5d5e, 0x5d5e, 0x5ce4, 0x5c61, 0x5c61,
+         0x445f, 0x435a, 0x435a, 0x4357, 0x4357, 0x4357, 0x4357, 0x4357,
+         0x4357, 0x4357, 0x4357, 0x4357, 0x4357, 0x3cda, 0x3c61, 0x3c56,
+         0x3bdd, 0x24df, 0x3bcf, 0x255e, 0x2557, 0x25d2, 0x264e, 0x2658},
+        {0x6259, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253,
+         0x6253, 0x6253, 0x6253, 0x6253, 0x5de3, 0x5c62, 0x42de, 0x4264,
+         0x425a, 0x425a, 0x4259, 0x4253, 0x4253, 0x4253, 0x4253, 0x4253,
+         0x4253, 0x4253, 0x4253, 0x4253, 0x4253, 0x3c62, 0x3c61, 0x3c5b,
+         0x3bdd, 0x3bd2, 0x3b5b, 0x3b4b, 0x3a57, 0x39d6, 0x3956, 0x36b4},
+        {0x6064, 0x6064, 0x605a, 0x605a, 0x6064, 0x6064, 0x605a, 0x605a,
+         0x7b62, 0x7ada, 0x7ada, 0x7a57, 0x79d6, 0x794a, 0x764b, 0x75cf,
+         0x75cf, 0x4064, 0x4064, 0x405a, 0x405a, 0x5b62, 0x5ada, 0x5ada,
+         0x5a57, 0x59d6, 0x594a, 0x564b, 0x55cf, 0x55cf, 0x5556, 0x54da,
+         0x54da, 0x5463, 0x3b62, 0x3ada, 0x3a57, 0x39d6, 0x3956, 0x36ca},
+        {0x9164, 0x9164, 0x6064, 0x6064, 0x605a, 0x605a, 0x7de3, 0x7de3,
+         0x7dda, 0x7dda, 0x7dd8, 0x7d52, 0x7d52, 0x7d47, 0x7d47, 0x64df,
+         0x64df, 0x64df, 0x64df, 0x5de3, 0x5de3, 0x5dda, 0x5dda, 0x5dd8,
+         0x5d52, 0x5d52, 0x5d47, 0x5d47, 0x44df, 0x44df, 0x44df, 0x44df,
+         0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df},
+        {0x9162, 0x84e0, 0x6064, 0x6064, 0x7e5f, 0x7de4, 0x7d5e, 0x7d5e,
+         0x7ce4, 0x7ce4, 0x7cd9, 0x7cce, 0x7c54, 0x7c47, 0x64e0, 0x64df,
+         0x64df, 0x64df, 0x64df, 0x5de3, 0x5de3, 0x5dda, 0x5dda, 0x5d5d,
+         0x5d52, 0x5cd8, 0x5cd8, 0x5ccc, 0x44df, 0x44df, 0x44df, 0x44df,
+         0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df},
+        {0x8357, 0x8357, 0x8357, 0x8357, 0x7de3, 0x7de3, 0x7dda, 0x7dda,
+         0x7d5d, 0x635a, 0x635a, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357,
+         0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x5d5e, 0x5d5e, 0x5ce4,
+         0x5ce4, 0x5cd9, 0x5cce, 0x5c54, 0x5c47, 0x44e0, 0x44e0, 0x44e0,
+         0x44e0, 0x44e0, 0x44e0, 0x44e0, 0x44e0, 0x44e0, 0x44e0, 0x44e0},
+        {0x8253, 0x8253, 0x8253, 0x8253, 0x7de3, 0x7de3, 0x7d5e, 0x7d5e,
+         0x625a, 0x625a, 0x625a, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253,
+         0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x5ce4,
+         0x5cda, 0x5cd9, 0x445f, 0x445f, 0x445e, 0x445e, 0x445e, 0x445e,
+         0x445e, 0x445e, 0x445e, 0x445e, 0x445e, 0x445e, 0x445e, 0x445e},
+    },
+    {
+        {0x615e, 0x6153, 0x6153, 0x6153, 0x6152, 0x6152, 0x6152, 0x6152,
+         0x6152, 0x6152, 0x6152, 0x6152, 0x4064, 0x4064, 0x405a, 0x405c,
+         0x4052, 0x4052, 0x4050, 0x4046, 0x4048, 0x403e, 0x403c, 0x4032,
+         0x402a, 0x4028, 0x401e, 0x4014, 0x4006, 0x2253, 0x2253, 0x2253,
+         0x2253, 0x2253, 0x2254, 0x2cde, 0x4046, 0x4046, 0x4048, 0x403e},
+        {0x605a, 0x6052, 0x6052, 0x6050, 0x6046, 0x6046, 0x603e, 0x603c,
+         0x6032, 0x602a, 0x6028, 0x601e, 0x4064, 0x4064, 0x5de3, 0x5de4,
+         0x5dda, 0x5dda, 0x5dd8, 0x5d52, 0x5d54, 0x5d47, 0x5d47, 0x5cc2,
+         0x5c3a, 0x5c3a, 0x5c2d, 0x5b2c, 0x59a2, 0x2152, 0x2152, 0x2152,
+         0x2152, 0x2152, 0x21b2, 0x2d56, 0x4046, 0x4046, 0x4048, 0x403e},
+        {0x7de4, 0x7de4, 0x7de4, 0x7ce4, 0x7cda, 0x7cd9, 0x645f, 0x7c54,
+         0x7bcf, 0x7bc2, 0x7bc2, 0x7b3b, 0x4064, 0x4064, 0x5de3, 0x5de4,
+         0x5d5e, 0x5d5e, 0x5ce4, 0x5cda, 0x5cd8, 0x5c56, 0x5c54, 0x5bcf,
+         0x5bc2, 0x5bc1, 0x5b3b, 0x5ab5, 0x5933, 0x2046, 0x2014, 0x2006,
+         0x2002, 0x2028, 0x201e, 0x2e57, 0x4046, 0x4046, 0x4048, 0x403e},
+        {0x7de3, 0x7dda, 0x7dda, 0x7d5d, 0x635a, 0x635a, 0x6357, 0x6357,
+         0x64df, 0x7b4b, 0x7b4b, 0x7ac7, 0x4064, 0x4064, 0x5de3, 0x5de4,
+         0x5d5e, 0x5d5e, 0x5ce4, 0x5c62, 0x5c61, 0x5bde, 0x5bdd, 0x5b5b,
+         0x5b4b, 0x5b4b, 0x5ac7, 0x5a42, 0x5933, 0x3c62, 0x313b, 0x313b,
+         0x313b, 0x313b, 0x313b, 0x314a, 0x4046, 0x4046, 0x4048, 0x403e},
+        {0x6264, 0x625a, 0x625a, 0x6259, 0x6253, 0x6253, 0x6253, 0x6253,
+         0x6253, 0x7ada, 0x7ad9, 0x6e57, 0x4064, 0x4064, 0x5de3, 0x5de4,
+         0x5d5e, 0x5d5e, 0x5ce4, 0x5c62, 0x5c61, 0x5bde, 0x5bdd, 0x5b5b,
+         0x5ada, 0x5ad9, 0x5a57, 0x59d6, 0x5933, 0x3c62, 0x3247, 0x31df,
+         0x31df, 0x31df, 0x31df, 0x31df, 0x4046, 0x4046, 0x4048, 0x403e},
+        {0x9463, 0x9463, 0x9463, 0x9463, 0x9463, 0x9463, 0x7b62, 0x7ada,
+         0x7b62, 0x7ada, 0x7ad9, 0x7a57, 0x4064, 0x4064, 0x5de3, 0x5de4,
+         0x5d5e, 0x5d5e, 0x5ce4, 0x5c62, 0x5c61, 0x5bde, 0x5bdd, 0x5b5b,
+         0x5ada, 0x5ad9, 0x5a57, 0x59d6, 0x58da, 0x3c62, 0x32cb, 0x325e,
+         0x325e, 0x325d, 0x325d, 0x325d, 0x4046, 0x4046, 0x4048, 0x403e},
+        {0x9164, 0x9164, 0x84df, 0x9c3a, 0x9c3a, 0x9c2d, 0x9b2c, 0x99a2,
+         0x7bdd, 0x7cda, 0x71c2, 0x7162, 0x4064, 0x4064, 0x5de3, 0x5de4,
+         0x5d5e, 0x5d5e, 0x5ce4, 0x5c62, 0x5c61, 0x5bde, 0x5bdd, 0x5b5b,
+         0x5ada, 0x5ad9, 0x5a57, 0x59d6, 0x58da, 0x3cda, 0x334f, 0x32e2,
+         0x32de, 0x32de, 0x32de, 0x32de, 0x4046, 0x4046, 0x4048, 0x403e},
+        {0x9cd8, 0x845f, 0x84df, 0x84e0, 0x9bc1, 0x9bb4, 0x9b2d, 0x99a2,
+         0x949e, 0x7c62, 0x71c2, 0x7162, 0x4064, 0x4064, 0x5de3, 0x5de4,
+         0x5d5e, 0x5d5e, 0x5ce4, 0x5c62, 0x5c61, 0x5bde, 0x5bdd, 0x5b5b,
+         0x5ada, 0x5ad9, 0x5a57, 0x59d6, 0x58da, 0x3c62, 0x334f, 0x32e2,
+         0x334f, 0x334f, 0x32de, 0x32de, 0x4046, 0x4046, 0x4048, 0x403e},
+        {0x835c, 0x8357, 0x8357, 0x845e, 0x9b4b, 0x9b3c, 0x9ab5, 0x99a3,
+         0x9526, 0x7c62, 0x71c2, 0x7162, 0x4064, 0x4064, 0x5de3, 0x5de4,
+         0x5d5e, 0x5d5e, 0x5ce4, 0x5c62, 0x5c61, 0x5bde, 0x5bdd, 0x5b5b,
+         0x5ada, 0x5ad9, 0x5a57, 0x59d6, 0x58da, 0x3c62, 0x33d2, 0x33d2,
+         0x33d2, 0x33d2, 0x335f, 0x335f, 0x4046, 0x4046, 0x4048, 0x403e},
+        {0x8254, 0x8254, 0x82c8, 0x82c2, 0x9ada, 0x9ad9, 0x8e57, 0x9933,
+         0x95ae, 0x7c62, 0x71c2, 0x7162, 0x7162, 0x7162, 0x5de3, 0x5de4,
+         0x5d5e, 0x5d5e, 0x5ce4, 0x5c62, 0x5c61, 0x5bde, 0x5bdd, 0x5b5b,
+         0x5ada, 0x5ad9, 0x5a57, 0x59d6, 0x58da, 0x5414, 0x3456, 0x33e1,
+         0x33e1, 0x33e1, 0x33e1, 0x4ed4, 0x52a5, 0x52a6, 0x5230, 0x5230},
+        {0xb463, 0xb463, 0xb463, 0x9b62, 0x9ada, 0x9ac8, 0x9a44, 0x99bc,
+         0x9638, 0x7c62, 0x71c2, 0x7162, 0x7162, 0x7162, 0x5de3, 0x6c15,
+         0x5d5e, 0x5d5e, 0x5ce4, 0x5c62, 0x5c61, 0x5bde, 0x5bdd, 0x5b5b,
+         0x5ada, 0x5ad9, 0x5a57, 0x59d6, 0x58da, 0x549e, 0x3456, 0x3456,
+         0x33e2, 0x33e2, 0x33e2, 0x4ed4, 0x53a7, 0x53a7, 0x532e, 0x52ba},
+        {0xb1c2, 0xb1c2, 0xb1c2, 0xb164, 0x9c62, 0x91c2, 0x91c2, 0x91cd,
+         0x91ce, 0x7c62, 0x71c2, 0x7162, 0x7162, 0x7162, 0x7162, 0x7162,
+         0x5d5e, 0x5d5e, 0x5ce4, 0x5c62, 0x5c61, 0x5bde, 0x5bdd, 0x5b5b,
+         0x5ada, 0x5ad9, 0x5a57, 0x59d6, 0x58da, 0x5510, 0x3463, 0x3463,
+         0x3463, 0x3463, 0x3554, 0x4ed4, 0x542f, 0x542f, 0x53b6, 0x533e},
+        {0xb247, 0xb247, 0xb1df, 0xb1df, 0xb1df, 0x91c2, 0x91c2, 0x91cd,
+         0x91ce, 0x7c62, 0x7247, 0x7162, 0x7162, 0x7162, 0x7162, 0x7162,
+         0x73a7, 0x72a5, 0x5ce4, 0x5c62, 0x5c61, 0x5bde, 0x5bdd, 0x5b5b,
+         0x5ada, 0x5ad9, 0x5a57, 0x59d6, 0x58da, 0x5510, 0x3463, 0x3463,
+         0x3463, 0x3463, 0x3560, 0x4ed4, 0x54b6, 0x543c, 0x53c4, 0x53c4},
+        {0xb2cb, 0xb2cb, 0xb25e, 0xb25e, 0xb25e, 0x91c2, 0x91c2, 0x91cd,
+         0x91ce, 0x7c62, 0x72cb, 0x7164, 0x7162, 0x71e2, 0x71e2, 0x71e2,
+         0x742f, 0x73b6, 0x733e, 0x5c62, 0x5c61, 0x5bde, 0x5bdd, 0x5b5b,
+         0x5ada, 0x5ad9, 0x5a57, 0x59d6, 0x58da, 0x5510, 0x355f, 0x38da,
+         0x36d3, 0x35dc, 0x3560, 0x4ed4, 0x54c2, 0x54c2, 0x5449, 0x5449},
+        {0xb2de, 0xb2de, 0xb2de, 0xb2de, 0xb2de, 0x91c2, 0x91c2, 0x91cd,
+         0x91ce, 0x7c62, 0x7352, 0x725e, 0x71e2, 0x72de, 0x72e4, 0x72e2,
+         0x743c, 0x743e, 0x73c4, 0x5c62, 0x6c15, 0x5bde, 0x5bde, 0x5b5b,
+         0x5ada, 0x5ad9, 0x5a57, 0x59d6, 0x58da, 0x5510, 0x355f, 0x38da,
+         0x36d3, 0x3656, 0x35da, 0x4ed4, 0x54c2, 0x54c2, 0x54c3, 0x544a},
+        {0xb360, 0xb360, 0xb360, 0xb360, 0xb510, 0x91c2, 0x91c2, 0x91cd,
+         0x91ce, 0x7c62, 0x73db, 0x72e2, 0x72e2, 0x735f, 0x7636, 0x753d,
+         0x74c2, 0x74b8, 0x743c, 0x73d4, 0x72a5, 0x5bde, 0x5bde, 0x5b5b,
+         0x5ada, 0x5ad9, 0x5a57, 0x59d6, 0x58da, 0x5510, 0x355f, 0x38da,
+         0x36d3, 0x3656, 0x35da, 0x4ed4, 0x5548, 0x54d0, 0x54ce, 0x5456},
+        {0xb35f, 0xb35f, 0xb35f, 0xb35f, 0xb35f, 0x91c2, 0x91c2, 0x91cd,
+         0x91ce, 0x7c62, 0x73db, 0x73db, 0x79d6, 0x735f, 0x7636, 0x7548,
+         0x74c2, 0x74c3, 0x744a, 0x7456, 0x73d2, 0x5bde, 0x5bde, 0x5b5b,
+         0x5ada, 0x5ad9, 0x5a57, 0x59d6, 0x58da, 0x5510, 0x39e3, 0x38de,
+         0x36dd, 0x3660, 0x4014, 0x4ed4, 0x554a, 0x554a, 0x54ce, 0x5456},
+        {0xb3e1, 0xb3e1, 0xb3e2, 0xb641, 0xb510, 0x91c2, 0x91c2, 0x91cd,
+         0x91ce, 0x7c62, 0x73e2, 0x73e2, 0x79d6, 0x78da, 0x7641, 0x7548,
+         0x74d0, 0x74ce, 0x7456, 0x7456, 0x744a, 0x73e1, 0x72a5, 0x5b62,
+         0x5ada, 0x5ad9, 0x5a57, 0x59d6, 0x58da, 0x5510, 0x39e3, 0x38de,
+         0x36de, 0x3662, 0x4014, 0x4ed4, 0x55cf, 0x5554, 0x54dc, 0x54da},
+        {0xb3e2, 0xb3e2, 0xb3e2, 0xb642, 0xb510, 0x91c2, 0x91c2, 0x91cd,
+         0x91ce, 0x7c62, 0x73e2, 0x73e2, 0x79d6, 0x78da, 0x7642, 0x75c6,
+         0x754a, 0x74ce, 0x7456, 0x7464, 0x7456, 0x743c, 0x73e2, 0x5b62,
+         0x5ada, 0x5ada, 0x5a57, 0x59d6, 0x58da, 0x5510, 0x51c4, 0x5162,
+         0x5162, 0x5162, 0x5162, 0x5162, 0x55cf, 0x5560, 0x5556, 0x54da},
+        {0xba58, 0xb9d8, 0xb9d0, 0xb64c, 0xb510, 0x91c2, 0x91c2, 0x91cd,
+         0x91ce, 0x7c62, 0x7ad9, 0x7a57, 0x79d6, 0x78da, 0x764b, 0x75cf,
+         0x7554, 0x7556, 0x74da, 0x7464, 0x7456, 0x6663, 0x6663, 0x6663,
+         0x6663, 0x6663, 0x5a5e, 0x59d9, 0x58da, 0x5621, 0x52ba, 0x51df,
+         0x51df, 0x51df, 0x51e2, 0x51e2, 0x55da, 0x5560, 0x555f, 0x6016},
+        {0xb463, 0xb9d6, 0xb94a, 0xb64b, 0xb510, 0x91c2, 0x91c2, 0x91cd,
+         0x91ce, 0x7c62, 0x7b62, 0x7a57, 0x79d6, 0x78da, 0x764b, 0x75cf,
+         0x7560, 0x7556, 0x74da, 0x7554, 0x7463, 0x6563, 0x6563, 0x6563,
+         0x6563, 0x6563, 0x5a5e, 0x59da, 0x58da, 0x562c, 0x533e, 0x525e,
+         0x525e, 0x525e, 0x52cb, 0x52d7, 0x55da, 0x55da, 0x555f, 0x6016},
+        {0xba60, 0xb9d9, 0xb958, 0xb6d4, 0x83e2, 0x91c2, 0x91c2, 0x91cd,
+         0x91ce, 0x8754, 0x7b62, 0x7a5e, 0x79d9, 0x78da, 0x76d3, 0x75dc,
+         0x7560, 0x755f, 0x755f, 0x7556, 0x64df, 0x64df, 0x64df, 0x64df,
+         0x64df, 0x64df, 0x64df, 0x59e3, 0x58de, 0x562c, 0x534f, 0x52de,
+         0x4b63, 0x52e0, 0x52de, 0x52de, 0x5660, 0x6046, 0x603e, 0x603c},
+        {0xba5e, 0xb9da, 0xb8da, 0xb6d3, 0x835a, 0x9247, 0x9247, 0x9252,
+         0x9252, 0x8748, 0x6064, 0x7a5e, 0x79da, 0x78da, 0x76d3, 0x7656,
+         0x75da, 0x755f, 0x6563, 0x645f, 0x645f, 0x645e, 0x645e, 0x645e,
+         0x645e, 0x645e, 0x645e, 0x59e3, 0x58de, 0x56b4, 0x53d2, 0x535f,
+         0x53d2, 0x5360, 0x535f, 0x535f, 0x5660, 0x6046, 0x603e, 0x603c},
+        {0xa3bb, 0xb9e4, 0xb960, 0xb6dd, 0x825a, 0x92cb, 0x92cb, 0x92d7,
+         0x92d7, 0x835a, 0x6064, 0x6064, 0x79e3, 0x78de, 0x76dd, 0x7660,
+         0x7660, 0x635a, 0x635a, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357,
+         0x6357, 0x6357, 0x6357, 0x59e3, 0x58de, 0x475c, 0x4a5a, 0x535f,
+         0x4de1, 0x53d2, 0x535f, 0x535f, 0x5662, 0x6046, 0x603e, 0x603c},
+        {0xa335, 0xb9e4, 0xb960, 0xb6dd, 0x81d2, 0x92e0, 0x92e0, 0x92de,
+         0x92de, 0x8253, 0x8253, 0x8253, 0x79e3, 0x6264, 0x625a, 0x625a,
+         0x6259, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253,
+         0x6253, 0x6254, 0x62c0, 0x62c0, 0x62c0, 0x56c0, 0x53e1, 0x4e61,
+         0x53e1, 0x53e1, 0x53e1, 0x6e58, 0x72a5, 0x7230, 0x7230, 0x7230},
+        {0xa1b2, 0xb9e3, 0xb8de, 0xb6de, 0x8046, 0x9360, 0x9360, 0x935f,
+         0x935f, 0x9636, 0x913f, 0x8f5c, 0x79e3, 0x78de, 0x76de, 0x7662,
+         0x76dd, 0x7660, 0x7660, 0x7660, 0x75dc, 0x7560, 0x755f, 0x755f,
+         0x7556, 0x74da, 0x74da, 0x7463, 0x7463, 0x5751, 0x5463, 0x525e,
+         0x51d7, 0x53e2, 0x53e2, 0x66df, 0x675e, 0x69e2, 0x72ba, 0x72ba},
+        {0xa028, 0xa01e, 0xa014, 0xa006, 0x9e58, 0x93db, 0x9162, 0x9164,
+         0x9162, 0x9636, 0x94da, 0x92e0, 0x925d, 0x6064, 0x7de3, 0x7de3,
+         0x7dda, 0x7dda, 0x7dd8, 0x7d52, 0x7d52, 0x7d47, 0x7d47, 0x7cc2,
+         0x7c3a, 0x7c3a, 0x7c2d, 0x7b2c, 0x79a2, 0x7414, 0x56c9, 0x5463,
+         0x5463, 0x5463, 0x5463, 0x66df, 0x675c, 0x69e1, 0x733e, 0x733e},
+        {0xb1c2, 0xb1cd, 0xb1ce, 0xb1ce, 0x9d52, 0x93e2, 0x91df, 0x84e0,
+         0x84e0, 0x84e0, 0x84e0, 0x84e0, 0x6064, 0x6064, 0x7de3, 0x7de3,
+         0x7dda, 0x7d5e, 0x7d5d, 0x7ce4, 0x7cd8, 0x7cd8, 0x7ccc, 0x7c54,
+         0x64e0, 0x64e0, 0x64e0, 0x64e0, 0x64e0, 0x59da, 0x56dd, 0x55cf,
+         0x5456, 0x5463, 0x5463, 0x665a, 0x6752, 0x69d6, 0x6a5a, 0x6ae2},
+        {0xb1c2, 0xb1cd, 0xb1ce, 0xb1ce, 0x9ce4, 0x845f, 0x845e, 0x845e,
+         0x845e, 0x845e, 0x845e, 0x6064, 0x6064, 0x605a, 0x7e5f, 0x7de3,
+         0x7d5e, 0x7d5e, 0x7ce4, 0x7c62, 0x7c62, 0x645f, 0x645f, 0x645e,
+         0x645e, 0x645e, 0x645e, 0x645e, 0x5a5e, 0x5956, 0x5752, 0x5656,
+         0x555f, 0x555f, 0x555f, 0x6658, 0x66d4, 0x69d6, 0x6a5a, 0x6ae2},
+        {0xb1c2, 0xb1cd, 0xb1ce, 0xb1ce, 0x83e2, 0x835c, 0x835c, 0x8358,
+         0x8358, 0x8358, 0x8358, 0x8358, 0x8358, 0x7e5f, 0x7de3, 0x7de3,
+         0x7dda, 0x7d5e, 0x63e2, 0x635c, 0x635c, 0x6358, 0x6358, 0x6358,
+         0x6358, 0x6358, 0x6358, 0x6358, 0x5a5e, 0x5956, 0x5752, 0x5656,
+         0x55da, 0x555f, 0x555f, 0x6658, 0x66d4, 0x69d6, 0x6a5a, 0x6ae2},
+    },
+    {
+        {0x8046, 0x8046, 0x82de, 0x815e, 0x815e, 0x8153, 0x8153, 0x8153,
+         0x8152, 0x8152, 0x635a, 0x635a, 0x6357, 0x6357, 0x6357, 0x6357,
+         0x6064, 0x6064, 0x605a, 0x605a, 0x6052, 0x6052, 0x6050, 0x6046,
+         0x6046, 0x603e, 0x603c, 0x6032, 0x602a, 0x6028, 0x601e, 0x6014,
+         0x6006, 0x4663, 0x4663, 0x4663, 0x4663, 0x46df, 0x475e, 0x4663},
+        {0x9d52, 0x8064, 0x8064, 0x805a, 0x805a, 0x8052, 0x8052, 0x8050,
+         0x8046, 0x8046, 0x635a, 0x635a, 0x6357, 0x6357, 0x6357, 0x615e,
+         0x6064, 0x6064, 0x7de3, 0x7de3, 0x7dda, 0x7dda, 0x7dd8, 0x7d52,
+         0x6663, 0x6663, 0x6663, 0x6663, 0x6663, 0x6663, 0x6663, 0x6663,
+         0x6663, 0x4664, 0x4664, 0x4664, 0x4664, 0x46e0, 0x475c, 0x49e1},
+        {0x815e, 0x8064, 0x8064, 0x9e5f, 0x9de4, 0x9de4, 0x9de4, 0x62de,
+         0x62de, 0x62de, 0x62d6, 0x62d5, 0x62d5, 0x6064, 0x6064, 0x605a,
+         0x605a, 0x6052, 0x7de3, 0x7de3, 0x7d5e, 0x7d5e, 0x7ce4, 0x7cda,
+         0x6663, 0x6663, 0x6663, 0x6663, 0x6663, 0x6663, 0x4563, 0x4563,
+         0x4563, 0x4563, 0x45de, 0x45de, 0x465a, 0x4563, 0x4563, 0x4563},
+        {0x805a, 0x805a, 0x8052, 0x9de3, 0x9de3, 0x9dda, 0x6264, 0x625a,
+         0x625a, 0x6259, 0x6253, 0x6253, 0x6253, 0x6064, 0x6064, 0x7e5f,
+         0x7de4, 0x7de4, 0x7de3, 0x7dd8, 0x7c62, 0x7c62, 0x7bde, 0x7bde,
+         0x6563, 0x6563, 0x6563, 0x6563, 0x6563, 0x6563, 0x4663, 0x4663,
+         0x4663, 0x4663, 0x4663, 0x4663, 0x4663, 0x4663, 0x4663, 0x4663},
+        {0x9e5f, 0x9de4, 0x9de4, 0x9de3, 0x9dd8, 0x615e, 0x615e, 0x6153,
+         0x6153, 0x6153, 0x6152, 0x6152, 0x6152, 0x6064, 0x6064, 0x7de3,
+         0x7de3, 0x7dda, 0x7dda, 0x7d5d, 0x635a, 0x635a, 0x6357, 0x7bde,
+         0x7b5b, 0x6563, 0x6563, 0x6563, 0x6563, 0x6563, 0x4664, 0x4564,
+         0x4564, 0x4564, 0x4564, 0x45dd, 0x4658, 0x4564, 0x4564, 0x4564},
+        {0x9de3, 0x9de3, 0x825a, 0x6064, 0x6064, 0x605a, 0x605a, 0x6052,
+         0x6052, 0x6050, 0x6046, 0x6046, 0x603e, 0x603c, 0x6032, 0x7de3,
+         0x7de3, 0x625a, 0x625a, 0x625a, 0x4663, 0x4663, 0x4663, 0x4663,
+         0x4663, 0x6563, 0x6563, 0x4563, 0x4563, 0x44df, 0x44df, 0x44df,
+         0x44df, 0x4557, 0x4557, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df},
+        {0x6064, 0x6064, 0x605a, 0x605a, 0x6052, 0x60db, 0x60db, 0x60d2,
+         0x60d2, 0x60d2, 0x60d2, 0x60d2, 0x60db, 0x60db, 0x60d2, 0x60d2,
+         0x60d2, 0x4563, 0x4563, 0x4563, 0x4563, 0x4563, 0x4563, 0x4563,
+         0x4563, 0x64df, 0x64df, 0x64df, 0x64df, 0x64df, 0x44e0, 0x44e0,
+         0x44e0, 0x44e0, 0x4558, 0x4558, 0x44e0, 0x44e0, 0x44e0, 0x44e0},
+        {0x6064, 0x6064, 0x7e5f, 0x7e5f, 0x7e5a, 0x7e5a, 0x7e58, 0x7dce,
+         0x7dce, 0x7dc3, 0x7dc3, 0x7d3e, 0x7d32, 0x7cb4, 0x7ca8, 0x6664,
+         0x6664, 0x4563, 0x4563, 0x4563, 0x4563, 0x4563, 0x4563, 0x4563,
+         0x4563, 0x64df, 0x64df, 0x445f, 0x445f, 0x445e, 0x445e, 0x445e,
+         0x445e, 0x445f, 0x445f, 0x445e, 0x445e, 0x445e, 0x445e, 0x445e},
+        {0x6064, 0x6064, 0x7de3, 0x7de3, 0x7d5e, 0x7d5e, 0x7ce4, 0x7ce4,
+         0x7cd8, 0x7cce, 0x7c54, 0x7c47, 0x6563, 0x6563, 0x6563, 0x6563,
+         0x645f, 0x4563, 0x4563, 0x4563, 0x4563, 0x4563, 0x4563, 0x4563,
+         0x4563, 0x645e, 0x44df, 0x44df, 0x4460, 0x4460, 0x445c, 0x445c,
+         0x445c, 0x445c, 0x4460, 0x4460, 0x445c, 0x445c, 0x445c, 0x445c},
+        {0x6064, 0x6064, 0x7de3, 0x7de3, 0x7d5e, 0x7d5e, 0x7ce4, 0x7c62,
+         0x7c61, 0x7c56, 0x7bdd, 0x64df, 0x64df, 0x64df, 0x64df, 0x64df,
+         0x645f, 0x44df, 0x455e, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df,
+         0x4557, 0x43e2, 0x43e2, 0x43da, 0x43da, 0x43da, 0x43da, 0x43e2,
+         0x43e2, 0x43da, 0x43da, 0x43da, 0x43da, 0x43da, 0x43da, 0x43da},
+        {0x83da, 0x6064, 0x7de3, 0x7de3, 0x7d5e, 0x7d5e, 0x7ce4, 0x63e2,
+         0x63e2, 0x63da, 0x63da, 0x63da, 0x63da, 0x63da, 0x63da, 0x63da,
+         0x63da, 0x63da, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df,
+         0x44e0, 0x435a, 0x435a, 0x4357, 0x4357, 0x4357, 0x4357, 0x435a,
+         0x435a, 0x4357, 0x4357, 0x4357, 0x4357, 0x4357, 0x4357, 0x4357},
+        {0x82d5, 0x6064, 0x7de3, 0x7de3, 0x7d5e, 0x62de, 0x62de, 0x62de,
+         0x62d6, 0x62d5, 0x62d5, 0x62d5, 0x62d5, 0x62d5, 0x62d5, 0x62d5,
+         0x61e2, 0x62d5, 0x445e, 0x445e, 0x445e, 0x445e, 0x445e, 0x445e,
+         0x44d3, 0x4460, 0x435c, 0x435c, 0x4358, 0x4358, 0x4358, 0x4358,
+         0x435c, 0x435c, 0x4358, 0x4358, 0x4358, 0x4358, 0x4358, 0x4358},
+        {0x64df, 0x655e, 0x6557, 0x60db, 0x60db, 0x60d2, 0x60d2, 0x60d2,
+         0x60d2, 0x60d2, 0x60d2, 0x60d2, 0x60d2, 0x60d2, 0x60d2, 0x60d2,
+         0x60d2, 0x60d2, 0x445e, 0x445c, 0x445c, 0x445c, 0x445c, 0x445c,
+         0x42de, 0x42d6, 0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x42de, 0x42d6,
+         0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x42d5},
+        {0x64df, 0x64e0, 0x6557, 0x6558, 0x65d1, 0x66cc, 0x69cc, 0x6a4f,
+         0x6046, 0x6b64, 0x603e, 0x603c, 0x6032, 0x602a, 0x6028, 0x601e,
+         0x7de4, 0x6006, 0x43e2, 0x43da, 0x43da, 0x43da, 0x444e, 0x444e,
+         0x4259, 0x4253, 0x4253, 0x4253, 0x4253, 0x4254, 0x4259, 0x4253,
+         0x4253, 0x4253, 0x4253, 0x4253, 0x4253, 0x4253, 0x4254, 0x4254},
+        {0x645e, 0x64d3, 0x64d3, 0x654e, 0x6642, 0x66c2, 0x6946, 0x6a4e,
+         0x6ad2, 0x6bda, 0x7cce, 0x6ce2, 0x7c47, 0x6563, 0x7bc1, 0x65de,
+         0x665b, 0x665a, 0x43ca, 0x435a, 0x4357, 0x4357, 0x43ca, 0x43ca,
+         0x4153, 0x4152, 0x4152, 0x4152, 0x4152, 0x4153, 0x4153, 0x4152,
+         0x4152, 0x4152, 0x4152, 0x4152, 0x4152, 0x4152, 0x41b2, 0x41b2},
+        {0x635a, 0x645c, 0x64d3, 0x654c, 0x65c8, 0x66c0, 0x6663, 0x6663,
+         0x6663, 0x6663, 0x6663, 0x6663, 0x64df, 0x655e, 0x6564, 0x6557,
+         0x65d2, 0x664e, 0x4357, 0x4358, 0x435c, 0x4357, 0x4358, 0x43ca,
+         0x4050, 0x4046, 0x4046, 0x403e, 0x403c, 0x4032, 0x402a, 0x4028,
+         0x401e, 0x4014, 0x4006, 0x2663, 0x26df, 0x275e, 0x295e, 0x4016},
+        {0x644e, 0x644e, 0x644e, 0x64c6, 0x6542, 0x66b6, 0x6a3a, 0x6bcc,
+         0x7c62, 0x7c61, 0x645f, 0x6460, 0x645e, 0x645c, 0x64d4, 0x654c,
+         0x644e, 0x6642, 0x42d6, 0x42d5, 0x4345, 0x4358, 0x4345, 0x4345,
+         0x5dd8, 0x5dce, 0x5d54, 0x445f, 0x445f, 0x445e, 0x445c, 0x445c,
+         0x445c, 0x445c, 0x445f, 0x445e, 0x445c, 0x445c, 0x445c, 0x445c},
+        {0x63ca, 0x6443, 0x62ca, 0x634d, 0x6443, 0x66ab, 0x6152, 0x6cc6,
+         0x635a, 0x635c, 0x6357, 0x6358, 0x63ca, 0x63cc, 0x6444, 0x6440,
+         0x64b9, 0x6534, 0x41d4, 0x41d2, 0x41d4, 0x42c0, 0x42c2, 0x4334,
+         0x5d5d, 0x43e2, 0x43e2, 0x43da, 0x43da, 0x43da, 0x43da, 0x43e2,
+         0x43e2, 0x43da, 0x43da, 0x43da, 0x43da, 0x43da, 0x43da, 0x43da},
+        {0x63ca, 0x63cc, 0x61c2, 0x6440, 0x61b6, 0x61d6, 0x63da, 0x4064,
+         0x405a, 0x405c, 0x405c, 0x4052, 0x4052, 0x4046, 0x403e, 0x403c,
+         0x403e, 0x41d6, 0x4048, 0x403e, 0x403c, 0x403e, 0x403c, 0x4032,
+         0x5d5e, 0x5d5a, 0x5d5a, 0x5cce, 0x5cce, 0x5c47, 0x5c3e, 0x5c3e,
+         0x2563, 0x23da, 0x23da, 0x244e, 0x24c6, 0x23e2, 0x23e2, 0x23da},
+        {0x6345, 0x6345, 0x63ba, 0x63ba, 0x6432, 0x4064, 0x4064, 0x405a,
+         0x405a, 0x4052, 0x4052, 0x4050, 0x4046, 0x4046, 0x403e, 0x403c,
+         0x4032, 0x402a, 0x4028, 0x401e, 0x4014, 0x4006, 0x21e2, 0x21e2,
+         0x21d6, 0x21d6, 0x21d6, 0x21d2, 0x21d2, 0x21d2, 0x21d2, 0x21d2,
+         0x21d2, 0x21d2, 0x21d2, 0x21d2, 0x21d2, 0x21d2, 0x223a, 0x223a},
+        {0x62c0, 0x62c0, 0x6333, 0x6333, 0x6334, 0x4064, 0x4064, 0x5de3,
+         0x5de3, 0x5dda, 0x5dda, 0x5d5d, 0x5d52, 0x5cd8, 0x5cd8, 0x5ccc,
+         0x5d3e, 0x4563, 0x4563, 0x4563, 0x4563, 0x4563, 0x20db, 0x20db,
+         0x20d2, 0x20d2, 0x20d2, 0x20d2, 0x20d2, 0x20d2, 0x20d2, 0x20d2,
+         0x20d2, 0x20d2, 0x20d2, 0x20d2, 0x20d2, 0x20d2, 0x20d2, 0x20d2},
+        {0x61b2, 0x61b2, 0x61b2, 0x7bc2, 0x6222, 0x405a, 0x405a, 0x5de3,
+         0x5de3, 0x5d5e, 0x5d5e, 0x5ce4, 0x5c62, 0x5c61, 0x5c56, 0x5c5b,
+         0x44df, 0x44df, 0x44df, 0x44df, 0x2064, 0x2064, 0x205a, 0x205a,
+         0x2052, 0x2052, 0x2050, 0x2046, 0x2046, 0x203e, 0x203c, 0x2032,
+         0x202a, 0x2028, 0x201e, 0x2014, 0x2006, 0x2002, 0x2028, 0x201e},
+        {0x602a, 0x6028, 0x7bde, 0x6014, 0x6006, 0x5e5f, 0x5de4, 0x5de3,
+         0x5de3, 0x5d5e, 0x5d5e, 0x5ce4, 0x445f, 0x445f, 0x445e, 0x445e,
+         0x445e, 0x445e, 0x445e, 0x445e, 0x445e, 0x445e, 0x3e5f, 0x3de4,
+         0x3de4, 0x3de4, 0x3dd8, 0x3c62, 0x3c62, 0x245f, 0x245f, 0x245e,
+         0x24d3, 0x24d3, 0x245f, 0x245f, 0x245e, 0x245e, 0x245e, 0x245e},
+        {0x71cd, 0x71ce, 0x71ce, 0x635a, 0x7162, 0x5de3, 0x5de3, 0x5dda,
+         0x5dda, 0x5d5d, 0x5d52, 0x5cd8, 0x435a, 0x435a, 0x4357, 0x4357,
+         0x4357, 0x4357, 0x4357, 0x4357, 0x4357, 0x4357, 0x3de3, 0x3de3,
+         0x3dda, 0x3dda, 0x3d5d, 0x3d52, 0x3cd8, 0x245f, 0x245f, 0x245e,
+         0x245c, 0x245e, 0x245f, 0x245f, 0x245e, 0x245c, 0x245c, 0x245c},
+        {0x71cd, 0x71ce, 0x71ce, 0x7164, 0x62e0, 0x7162, 0x6253, 0x5d5e,
+         0x4264, 0x425a, 0x425a, 0x4259, 0x4253, 0x4253, 0x4253, 0x4253,
+         0x4253, 0x4253, 0x4253, 0x4253, 0x4253, 0x4253, 0x4253, 0x4253,
+         0x3d5e, 0x3d5e, 0x3ce4, 0x23e2, 0x23e2, 0x23da, 0x23da, 0x23da,
+         0x23e2, 0x23e2, 0x23da, 0x23da, 0x23da, 0x23da, 0x244e, 0x244e},
+        {0x7252, 0x7252, 0x71df, 0x6663, 0x66df, 0x675e, 0x69e2, 0x6f1f,
+         0x6eb5, 0x6fb3, 0x6fb3, 0x6fdb, 0x6f54, 0x6fc7, 0x4064, 0x4064,
+         0x405a, 0x405a, 0x4052, 0x4052, 0x5b62, 0x5ada, 0x5a57, 0x59ce,
+         0x58ca, 0x564b, 0x55cf, 0x5560, 0x5556, 0x54da, 0x5463, 0x3b62,
+         0x3ada, 0x3ada, 0x3a57, 0x39d6, 0x38da, 0x364b, 0x35cf, 0x34da},
+        {0x72d7, 0x72d7, 0x725e, 0x6663, 0x66df, 0x66e0, 0x695d, 0x7340,
+         0x72ba, 0x723b, 0x71ce, 0x7162, 0x7d47, 0x71ce, 0x64df, 0x64df,
+         0x5de3, 0x5de3, 0x5dda, 0x5dda, 0x5dd8, 0x5d52, 0x5d52, 0x5d47,
+         0x5d47, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df,
+         0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df},
+        {0x6563, 0x6563, 0x65de, 0x665b, 0x665a, 0x6752, 0x68db, 0x69e2,
+         0x6ae2, 0x6ae3, 0x72d7, 0x64e0, 0x64e0, 0x64e0, 0x64df, 0x64df,
+         0x5de3, 0x5de3, 0x5dda, 0x5dda, 0x5d5d, 0x5d52, 0x5cd8, 0x5cd8,
+         0x5ccc, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df,
+         0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df},
+        {0x6563, 0x6563, 0x6563, 0x65de, 0x6658, 0x6658, 0x635a, 0x635a,
+         0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357,
+         0x6357, 0x6357, 0x5d5e, 0x5d5e, 0x5ce4, 0x5ce4, 0x5cd9, 0x5cce,
+         0x5c54, 0x5c47, 0x44e0, 0x44e0, 0x44e0, 0x44e0, 0x44e0, 0x44e0,
+         0x44e0, 0x44e0, 0x44e0, 0x44e0, 0x44e0, 0x44e0, 0x44e0, 0x44e0},
+        {0x6563, 0x6563, 0x6563, 0x65de, 0x6658, 0x625a, 0x625a, 0x625a,
+         0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253,
+         0x6253, 0x6253, 0x6253, 0x6253, 0x5ce4, 0x5cda, 0x5cd9, 0x445f,
+         0x445f, 0x445e, 0x445e, 0x445e, 0x445e, 0x445e, 0x445e, 0x445e,
+         0x445e, 0x445e, 0x445e, 0x445e, 0x445e, 0x445e, 0x445e, 0x445e},
+    },
+    {
+        {0x8253, 0x6064, 0x6064, 0x605a, 0x605a, 0x615e, 0x615e, 0x6153,
+         0x6153, 0x6153, 0x6152, 0x6152, 0x6152, 0x6152, 0x6152, 0x6152,
+         0x6152, 0x6152, 0x4064, 0x4064, 0x405a, 0x405a, 0x4052, 0x4052,
+         0x4050, 0x4046, 0x4046, 0x403e, 0x403c, 0x4032, 0x402a, 0x4028,
+         0x401e, 0x4014, 0x4006, 0x2663, 0x26df, 0x275e, 0x295e, 0x4016},
+        {0x8152, 0x8152, 0x8152, 0x6064, 0x6064, 0x605a, 0x605a, 0x6052,
+         0x6052, 0x6050, 0x6046, 0x6046, 0x603e, 0x603c, 0x6032, 0x602a,
+         0x6028, 0x601e, 0x6014, 0x6006, 0x5de3, 0x5de3, 0x42de, 0x42de,
+         0x42de, 0x42d6, 0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x42de, 0x42d6,
+         0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x42d5},
+        {0x802a, 0x8028, 0x801e, 0x7de3, 0x7de3, 0x7e5f, 0x7de4, 0x7de4,
+         0x7de4, 0x6064, 0x7c62, 0x605a, 0x605c, 0x605c, 0x60d2, 0x4064,
+         0x4064, 0x405a, 0x405a, 0x4052, 0x4052, 0x4050, 0x5d5e, 0x5d5e,
+         0x42e0, 0x42e0, 0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x42e0, 0x42e0,
+         0x2563, 0x2563, 0x25de, 0x265b, 0x265a, 0x26d6, 0x2563, 0x2563},
+        {0x8052, 0x8052, 0x8046, 0x8046, 0x803e, 0x7de3, 0x7de3, 0x7dda,
+         0x7dda, 0x7d5d, 0x7c62, 0x7c62, 0x605c, 0x7dd0, 0x7956, 0x4064,
+         0x4064, 0x405a, 0x405a, 0x4052, 0x4052, 0x4050, 0x4046, 0x4046,
+         0x403e, 0x403c, 0x4032, 0x402a, 0x4028, 0x401e, 0x4014, 0x4006,
+         0x2563, 0x2563, 0x25dd, 0x25dd, 0x2658, 0x26d4, 0x2563, 0x2563},
+        {0x8046, 0x803e, 0x803c, 0x8032, 0x8032, 0x8028, 0x801e, 0x7d5e,
+         0x6064, 0x7e60, 0x603c, 0x6032, 0x602a, 0x7ada, 0x4064, 0x4064,
+         0x405a, 0x5de3, 0x5de3, 0x5d5e, 0x5d5e, 0x5d5d, 0x5d52, 0x5cd8,
+         0x5cce, 0x5ccc, 0x5c47, 0x5c3a, 0x5bc1, 0x5bb3, 0x5b2c, 0x24df,
+         0x255e, 0x255e, 0x2557, 0x25d2, 0x24df, 0x24df, 0x24df, 0x24df},
+        {0x8046, 0x8046, 0x803e, 0x803c, 0x635a, 0x7de3, 0x7de3, 0x7d52,
+         0x7b56, 0x7a57, 0x7a57, 0x79d9, 0x79d6, 0x7958, 0x4064, 0x4064,
+         0x5e5f, 0x5de3, 0x5de3, 0x5d5e, 0x5d5e, 0x5cda, 0x5c61, 0x5c56,
+         0x5bdd, 0x5bcf, 0x5bc2, 0x5b4c, 0x5ac8, 0x5a44, 0x5933, 0x24df,
+         0x24e0, 0x255c, 0x2557, 0x2558, 0x24df, 0x24df, 0x24df, 0x24df},
+        {0x8050, 0x7de3, 0x7de3, 0x7de3, 0x7d5e, 0x7b5b, 0x7ada, 0x7ada,
+         0x7a5e, 0x79da, 0x79d9, 0x7956, 0x4064, 0x4264, 0x405a, 0x405c,
+         0x5de3, 0x5de3, 0x5dda, 0x5d5e, 0x5d5d, 0x5c62, 0x5c62, 0x5bde,
+         0x5bde, 0x5b5b, 0x5b4b, 0x5ad9, 0x5a58, 0x245f, 0x4c15, 0x245e,
+         0x24d3, 0x24d3, 0x245f, 0x245f, 0x245e, 0x245e, 0x245e, 0x245e},
+        {0x605a, 0x7de3, 0x7c62, 0x7dda, 0x7b62, 0x7b61, 0x7b62, 0x7a5e,
+         0x7a5e, 0x79da, 0x795f, 0x62de, 0x4064, 0x4064, 0x5e5f, 0x5de4,
+         0x5de3, 0x5de3, 0x5d5e, 0x5d5e, 0x5d54, 0x5ce4, 0x5c62, 0x5bde,
+         0x5bde, 0x5b5b, 0x5a60, 0x59d9, 0x5958, 0x245f, 0x245f, 0x245e,
+         0x245c, 0x24d3, 0x245f, 0x245f, 0x245e, 0x245c, 0x245c, 0x245c},
+        {0x7de4, 0x7de3, 0x7de3, 0x7d5e, 0x7b62, 0x7b62, 0x7bde, 0x7a5e,
+         0x795f, 0x795f, 0x4064, 0x4064, 0x405a, 0x405a, 0x5de3, 0x5de4,
+         0x5dda, 0x5de3, 0x5d5d, 0x5d52, 0x5cd8, 0x5cda, 0x5c62, 0x5bde,
+         0x5bde, 0x5b5b, 0x5a5e, 0x23e2, 0x23e2, 0x23da, 0x23da, 0x2452,
+         0x23e2, 0x23e2, 0x23da, 0x23da, 0x23da, 0x23da, 0x244e, 0x244e},
+        {0x7de3, 0x7dda, 0x7dda, 0x7d5d, 0x7d52, 0x7cd8, 0x6064, 0x615d,
+         0x605c, 0x6064, 0x4064, 0x4064, 0x5e5f, 0x4064, 0x5de3, 0x5de3,
+         0x5d5e, 0x4052, 0x4064, 0x5d52, 0x5cd8, 0x4ae3, 0x5c61, 0x5c47,
+         0x5bdd, 0x5b2c, 0x5a17, 0x23e2, 0x23e2, 0x23da, 0x23d9, 0x23d9,
+         0x23e2, 0x23e2, 0x23da, 0x23d9, 0x23d9, 0x23d9, 0x23d9, 0x244e},
+        {0x7de3, 0x7d5e, 0x7d5e, 0x6064, 0x6064, 0x605a, 0x605a, 0x6052,
+         0x6052, 0x6050, 0x6046, 0x6046, 0x5de3, 0x5de3, 0x5dda, 0x5dda,
+         0x5d5d, 0x5d5e, 0x6014, 0x5cda, 0x5ccc, 0x4ae4, 0x4ae3, 0x4b63,
+         0x5bb4, 0x5b2c, 0x59a2, 0x235a, 0x235a, 0x2357, 0x2357, 0x2357,
+         0x235a, 0x235a, 0x2357, 0x2357, 0x2357, 0x2357, 0x2357, 0x23ca},
+        {0x7dda, 0x7d5d, 0x6064, 0x6064, 0x605a, 0x605a, 0x6052, 0x6052,
+         0x6050, 0x6046, 0x6046, 0x603e, 0x603c, 0x6032, 0x5d5e, 0x5d5e,
+         0x601e, 0x6014, 0x4358, 0x4254, 0x5cda, 0x5c47, 0x4ae4, 0x4ae3,
+         0x22de, 0x22de, 0x22de, 0x22d6, 0x22d6, 0x22d6, 0x22d6, 0x22d6,
+         0x22d6, 0x22d6, 0x22d6, 0x22d6, 0x22d6, 0x2346, 0x2346, 0x2346},
+        {0x7d5e, 0x7d5d, 0x7d52, 0x6064, 0x605a, 0x605a, 0x605a, 0x6052,
+         0x6050, 0x6046, 0x6046, 0x603e, 0x603c, 0x6032, 0x6032, 0x6028,
+         0x601e, 0x434d, 0x414a, 0x58de, 0x5662, 0x5c5b, 0x5bc2, 0x4ae4,
+         0x225a, 0x225a, 0x225a, 0x2253, 0x2253, 0x2253, 0x2253, 0x2253,
+         0x2253, 0x2253, 0x2253, 0x2253, 0x2253, 0x2253, 0x22c2, 0x22c2},
+        {0x7d5e, 0x7ce4, 0x6064, 0x605a, 0x605a, 0x605a, 0x6052, 0x6050,
+         0x6046, 0x6046, 0x603e, 0x603c, 0x6032, 0x6032, 0x6028, 0x601e,
+         0x4254, 0x41b6, 0x42c8, 0x42c0, 0x4223, 0x4334, 0x5c5b, 0x21e2,
+         0x21d6, 0x21d6, 0x21d6, 0x21d2, 0x21d2, 0x21d2, 0x21d2, 0x21d2,
+         0x21d2, 0x21d2, 0x21d2, 0x21d2, 0x21d2, 0x21d2, 0x21d2, 0x21d2},
+        {0x61e0, 0x7ce4, 0x7cda, 0x7c61, 0x6064, 0x605a, 0x605a, 0x6050,
+         0x6052, 0x6050, 0x6046, 0x603e, 0x603c, 0x6034, 0x6032, 0x4259,
+         0x56c9, 0x5dba, 0x41b6, 0x5e2b, 0x42c2, 0x42b2, 0x5b1c, 0x5987,
+         0x2052, 0x2052, 0x2050, 0x2046, 0x2046, 0x203e, 0x203c, 0x2032,
+         0x202a, 0x2028, 0x201e, 0x2014, 0x2006, 0x2002, 0x2028, 0x201e},
+        {0x605a, 0x6052, 0x7c62, 0x7c61, 0x7c5b, 0x7bdd, 0x7bd2, 0x7b4b,
+         0x7b4b, 0x7ac7, 0x7a42, 0x7936, 0x7636, 0x753d, 0x59d9, 0x59ce,
+         0x4748, 0x5e42, 0x555f, 0x5d32, 0x43ab, 0x402a, 0x42b2, 0x4020,
+         0x2052, 0x2052, 0x2050, 0x2046, 0x2046, 0x203e, 0x203c, 0x2032,
+         0x202a, 0x2028, 0x201e, 0x2014, 0x2006, 0x2002, 0x2028, 0x201e},
+        {0x7de4, 0x7de4, 0x7c62, 0x7c62, 0x7c5b, 0x7be0, 0x7bd2, 0x7b4b,
+         0x7b4b, 0x7ac7, 0x7a42, 0x7936, 0x7636, 0x7548, 0x7414, 0x72a5,
+         0x5d54, 0x5d48, 0x5d48, 0x5cc0, 0x5cb5, 0x5c2d, 0x5b2c, 0x3de3,
+         0x3dda, 0x3dda, 0x3dd8, 0x3d52, 0x3d52, 0x3d47, 0x3d47, 0x3cc2,
+         0x3c3a, 0x3c3a, 0x3bc1, 0x3ac8, 0x3933, 0x3416, 0x32a6, 0x31df},
+        {0x7de3, 0x7dda, 0x7dda, 0x7d5d, 0x7bde, 0x7bde, 0x7b5b, 0x7b56,
+         0x7b54, 0x7acd, 0x7a47, 0x7942, 0x7641, 0x7548, 0x749e, 0x7422,
+         0x73a7, 0x5660, 0x51e2, 0x4b64, 0x5bc1, 0x5b2c, 0x3de3, 0x3de3,
+         0x3d5e, 0x3d5e, 0x3d5d, 0x3d52, 0x3cd8, 0x3cce, 0x3ccc, 0x3c47,
+         0x3c3a, 0x3bc1, 0x3b3b, 0x3a42, 0x38da, 0x349e, 0x3422, 0x332e},
+        {0x62de, 0x7d5e, 0x7d5e, 0x615e, 0x7bde, 0x7bde, 0x7b5b, 0x7b56,
+         0x7ad9, 0x7a58, 0x79d8, 0x7942, 0x7642, 0x6259, 0x425a, 0x42de,
+         0x62d6, 0x73b6, 0x5c54, 0x5bdd, 0x4bd8, 0x59bc, 0x564b, 0x5398,
+         0x3d5e, 0x3d5e, 0x3ce4, 0x3ce4, 0x3cd9, 0x3cce, 0x3c54, 0x3c47,
+         0x3bcf, 0x3b4b, 0x3ac7, 0x39d6, 0x38da, 0x3526, 0x34aa, 0x342f},
+        {0x625a, 0x625a, 0x6259, 0x7ce4, 0x7cda, 0x7cd9, 0x615e, 0x615e,
+         0x615e, 0x6153, 0x615e, 0x6152, 0x41e2, 0x41e2, 0x41d6, 0x41d6,
+         0x41d6, 0x4264, 0x61c2, 0x5bb4, 0x59bc, 0x564b, 0x54c2, 0x549e,
+         0x53a7, 0x52a5, 0x52a5, 0x3cda, 0x3cda, 0x3c56, 0x3bdd, 0x3bcf,
+         0x3bc2, 0x3b4b, 0x3a57, 0x39d6, 0x38da, 0x35ae, 0x3532, 0x34b6},
+        {0x6153, 0x6153, 0x6064, 0x6064, 0x7d5e, 0x7c61, 0x7b62, 0x7ada,
+         0x7ada, 0x7a57, 0x4064, 0x4064, 0x405a, 0x405a, 0x4052, 0x4052,
+         0x4052, 0x4046, 0x4046, 0x59ce, 0x5656, 0x55da, 0x553d, 0x54c2,
+         0x5449, 0x5422, 0x533e, 0x3c62, 0x3c61, 0x3c5b, 0x3bdd, 0x3bd2,
+         0x3b4b, 0x3ada, 0x3a57, 0x39d6, 0x38da, 0x3636, 0x353d, 0x34c2},
+        {0x6052, 0x6052, 0x6050, 0x6046, 0x7c62, 0x7c62, 0x7c5b, 0x7c5b,
+         0x7b62, 0x7a5e, 0x4064, 0x4064, 0x405a, 0x5e60, 0x5e5a, 0x5e5a,
+         0x5dda, 0x5d52, 0x5ada, 0x5a5e, 0x5751, 0x555f, 0x555f, 0x54c2,
+         0x5456, 0x543c, 0x53c4, 0x3c62, 0x3c62, 0x3c5b, 0x3bde, 0x3b5b,
+         0x3b4b, 0x3ad9, 0x3a57, 0x39d6, 0x38da, 0x3636, 0x3548, 0x34c2},
+        {0x7de4, 0x7de4, 0x7dd8, 0x6663, 0x7d54, 0x7d54, 0x66df, 0x66df,
+         0x66df, 0x7a5e, 0x675e, 0x69e1, 0x5de3, 0x5de3, 0x5d5e, 0x5d5e,
+         0x5ce4, 0x5b61, 0x5b56, 0x59e3, 0x575b, 0x55dc, 0x55cf, 0x5548,
+         0x54ce, 0x4663, 0x4663, 0x4663, 0x4663, 0x3bde, 0x3bde, 0x3b5b,
+         0x3ada, 0x3ad9, 0x3a57, 0x39d6, 0x38da, 0x3641, 0x3548, 0x34d0},
+        {0x61e0, 0x615e, 0x7d5d, 0x7d52, 0x65d2, 0x65dd, 0x665a, 0x6658,
+         0x66ca, 0x66d4, 0x66d6, 0x66d6, 0x5de3, 0x5de3, 0x5d5e, 0x5d5e,
+         0x5bde, 0x5ada, 0x5ad9, 0x595f, 0x575b, 0x5660, 0x4563, 0x4563,
+         0x4563, 0x4563, 0x4563, 0x4563, 0x4563, 0x3bde, 0x4563, 0x3b5b,
+         0x3ada, 0x3ad9, 0x3a57, 0x39d6, 0x38da, 0x3642, 0x35c6, 0x354a},
+        {0x812a, 0x801e, 0x6264, 0x61e0, 0x6153, 0x7ccc, 0x654c, 0x65d1,
+         0x65d1, 0x6658, 0x6658, 0x66ca, 0x66d4, 0x64d3, 0x5d5e, 0x5be0,
+         0x5b62, 0x5b5b, 0x59e3, 0x58de, 0x56dd, 0x5662, 0x4563, 0x44df,
+         0x44e0, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x3b62,
+         0x3ada, 0x3ad9, 0x3a57, 0x39d6, 0x38da, 0x364b, 0x35cf, 0x3554},
+        {0x814a, 0x61e2, 0x8032, 0x812a, 0x801e, 0x61d5, 0x61d6, 0x62c8,
+         0x7b62, 0x654c, 0x65d1, 0x65d1, 0x6658, 0x63da, 0x5bde, 0x5bde,
+         0x5bde, 0x5ada, 0x5a5e, 0x595f, 0x575b, 0x43e2, 0x43e2, 0x43da,
+         0x43da, 0x43da, 0x43da, 0x43da, 0x43da, 0x43da, 0x43da, 0x3b62,
+         0x3ada, 0x3ada, 0x3a57, 0x39d6, 0x38da, 0x364b, 0x35cf, 0x3560},
+        {0x8046, 0x60db, 0x8050, 0x814a, 0x61e2, 0x62de, 0x614a, 0x62de,
+         0x6064, 0x6064, 0x6032, 0x62ac, 0x6534, 0x65d1, 0x62d5, 0x62d5,
+         0x5bde, 0x5b62, 0x42de, 0x42de, 0x42de, 0x42d6, 0x42d5, 0x42d5,
+         0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x42d5,
+         0x42d5, 0x42d5, 0x3a5e, 0x39d9, 0x38da, 0x36d3, 0x35dc, 0x3560},
+        {0x85de, 0x80d2, 0x8052, 0x8046, 0x60db, 0x605c, 0x6264, 0x625a,
+         0x6151, 0x614a, 0x61c0, 0x615e, 0x61c0, 0x6032, 0x60d2, 0x60d2,
+         0x60d2, 0x5b62, 0x5a5e, 0x40db, 0x40db, 0x40d2, 0x40d2, 0x40d2,
+         0x40d2, 0x40d2, 0x40d2, 0x40d2, 0x40d2, 0x40d2, 0x40d2, 0x40d2,
+         0x40d2, 0x40d2, 0x3a5e, 0x39da, 0x38da, 0x36d3, 0x3656, 0x35da},
+        {0x8357, 0x8357, 0x8357, 0x6064, 0x6064, 0x615e, 0x615e, 0x6153,
+         0x7dd0, 0x6357, 0x6460, 0x7e5a, 0x7de4, 0x6557, 0x6658, 0x6953,
+         0x6a5a, 0x6b63, 0x6b64, 0x6c63, 0x415e, 0x415e, 0x4153, 0x4153,
+         0x4153, 0x4152, 0x4152, 0x4152, 0x4152, 0x4153, 0x4153, 0x4152,
+         0x4152, 0x4152, 0x4152, 0x4152, 0x4152, 0x4152, 0x41b2, 0x41b2},
+        {0x8253, 0x6064, 0x6064, 0x6064, 0x6064, 0x605a, 0x605a, 0x6052,
+         0x6052, 0x7dda, 0x6358, 0x645f, 0x64d3, 0x6557, 0x6658, 0x6953,
+         0x6a5a, 0x6b63, 0x4064, 0x4064, 0x59e3, 0x58de, 0x56de, 0x5662,
+         0x5662, 0x5662, 0x5662, 0x5662, 0x5662, 0x5662, 0x5662, 0x5662,
+         0x5662, 0x5662, 0x5662, 0x39e3, 0x38de, 0x36de, 0x3662, 0x4016},
+    },
+    {
+        {0x24c6, 0x2542, 0x25bb, 0x26b6, 0x29c9, 0x2a4e, 0x2ad2, 0x2ae3,
+         0x2b63, 0x2bd6, 0x2c5a, 0x2c5a, 0x2ce2, 0x2ce2, 0x405a, 0x405a,
+         0x405a, 0x4052, 0x4050, 0x4e41, 0x4ed4, 0x6c15, 0x6d9a, 0x6db0,
+         0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9, 0x6f47, 0x8c15,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x24c6, 0x2540, 0x25bb, 0x2638, 0x29c9, 0x2a4e, 0x2ad2, 0x2ae3,
+         0x2bd6, 0x2bd6, 0x2c59, 0x2c5a, 0x2ce1, 0x2ce2, 0x405a, 0x405a,
+         0x405a, 0x4052, 0x4050, 0x4e41, 0x4ed4, 0x6c15, 0x6d9a, 0x6db0,
+         0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9, 0x6f47, 0x8c15,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x2442, 0x24ba, 0x2536, 0x2638, 0x29c9, 0x2a4e, 0x2ad2, 0x2ae3,
+         0x2bd6, 0x2b63, 0x2c59, 0x2cd2, 0x2cde, 0x2cde, 0x2d62, 0x2d62,
+         0x4046, 0x4046, 0x403e, 0x403e, 0x4ed4, 0x6c15, 0x6d9a, 0x6db0,
+         0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9, 0x6f47, 0x8c15,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x23ba, 0x2432, 0x252a, 0x2622, 0x29c9, 0x2a4e, 0x2ae2, 0x2ae3,
+         0x2c4b, 0x2cc6, 0x2cd1, 0x2cdd, 0x2cdd, 0x2d56, 0x2d61, 0x2de2,
+         0x4046, 0x4046, 0x403e, 0x403e, 0x4ed4, 0x6c15, 0x6d9a, 0x6db0,
+         0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9, 0x6f47, 0x8c15,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x2333, 0x23ab, 0x24a2, 0x25a5, 0x29c9, 0x2a4f, 0x2ad6, 0x2ae3,
+         0x2b63, 0x2b63, 0x2cd0, 0x2d4a, 0x2d56, 0x2d56, 0x2ddb, 0x2ddb,
+         0x4046, 0x4046, 0x403e, 0x403e, 0x4ed4, 0x69e1, 0x6d9a, 0x6db0,
+         0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9, 0x6f47, 0x89e1,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x223a, 0x22ab, 0x2334, 0x251c, 0x29ca, 0x2a4f, 0x2ad6, 0x2ae3,
+         0x2b63, 0x2b63, 0x2d4a, 0x2d4a, 0x2dd0, 0x2dd2, 0x2ddb, 0x2ddb,
+         0x2e62, 0x2e62, 0x2e62, 0x4014, 0x4ed4, 0x69d6, 0x6a5a, 0x6ae2,
+         0x6ae3, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9, 0x6f47, 0x89d6,
+         0x8a5a, 0x8ae2, 0x8ae3, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x201e, 0x200a, 0x2002, 0x2002, 0x29ca, 0x2a4e, 0x2ad2, 0x2ae3,
+         0x2b63, 0x2bd6, 0x2c5a, 0x2c5a, 0x2ce2, 0x2ce2, 0x2e57, 0x2e57,
+         0x2e61, 0x2e61, 0x2e62, 0x4014, 0x4ed4, 0x69cc, 0x6a4f, 0x6ad6,
+         0x6ae3, 0x6b64, 0x6b63, 0x6e41, 0x6ebf, 0x6ec9, 0x6f47, 0x89cc,
+         0x8a4f, 0x8ad6, 0x8ae3, 0x8b64, 0x8b63, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x201e, 0x200a, 0x2002, 0x2002, 0x29c9, 0x2a4e, 0x2ad2, 0x2b52,
+         0x25de, 0x2bda, 0x2c59, 0x2c63, 0x2ec9, 0x2ed4, 0x2ed4, 0x2ee0,
+         0x2ee0, 0x2ee0, 0x2f5e, 0x4014, 0x4ed4, 0x69c9, 0x6a4e, 0x6ad2,
+         0x6ae3, 0x6b64, 0x6b63, 0x6c59, 0x6c5a, 0x6ce1, 0x6cde, 0x89c9,
+         0x8a4e, 0x8ad2, 0x8ae3, 0x8b64, 0x8b63, 0x8c59, 0x8c5a, 0x8ce1},
+        {0x2442, 0x24ba, 0x2536, 0x26ab, 0x29c9, 0x2a4e, 0x2ad2, 0x2b54,
+         0x2bd6, 0x275c, 0x2b63, 0x2cde, 0x3162, 0x3162, 0x3162, 0x3162,
+         0x3162, 0x3162, 0x3162, 0x4014, 0x4ed4, 0x69c9, 0x6a4e, 0x6ad2,
+         0x6ae3, 0x6b64, 0x6b63, 0x6c59, 0x6c5a, 0x6cdd, 0x6cde, 0x89c9,
+         0x8a4e, 0x8ad2, 0x8ae3, 0x8b64, 0x8b63, 0x8c59, 0x8c5a, 0x8cdd},
+        {0x2440, 0x2440, 0x2534, 0x262d, 0x29c9, 0x2a4e, 0x2ad2, 0x2bc8,
+         0x2bd6, 0x2bd6, 0x2ce2, 0x31df, 0x31df, 0x31df, 0x31df, 0x31df,
+         0x31e2, 0x31e2, 0x31e2, 0x4014, 0x4ed4, 0x69c9, 0x6a4e, 0x6ad2,
+         0x6b52, 0x6b64, 0x6bd6, 0x6c59, 0x6c5a, 0x6cdd, 0x6cde, 0x89c9,
+         0x8a4e, 0x8ad2, 0x8b52, 0x8b64, 0x8bd6, 0x8c59, 0x8c5a, 0x8cdd},
+        {0x3ada, 0x39d6, 0x385f, 0x35cf, 0x3556, 0x3463, 0x3463, 0x403e,
+         0x403c, 0x4032, 0x4ed4, 0x513b, 0x325e, 0x325e, 0x325e, 0x325e,
+         0x4046, 0x4046, 0x403e, 0x403e, 0x4ee0, 0x6c15, 0x6d9a, 0x6db0,
+         0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9, 0x6f47, 0x8c15,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x51c2, 0x51c2, 0x51c2, 0x5164, 0x5162, 0x5162, 0x5162, 0x5162,
+         0x5162, 0x5162, 0x5162, 0x51c2, 0x51c2, 0x32de, 0x32e2, 0x32e2,
+         0x4046, 0x4046, 0x403e, 0x403e, 0x5162, 0x6c15, 0x6d9a, 0x6db0,
+         0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9, 0x6f47, 0x8c15,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x5247, 0x5247, 0x51df, 0x51df, 0x51df, 0x51df, 0x51df, 0x51df,
+         0x51df, 0x51df, 0x51c2, 0x51c2, 0x51c2, 0x51cd, 0x5164, 0x5164,
+         0x5162, 0x5162, 0x5162, 0x5162, 0x51df, 0x6c15, 0x6d9a, 0x6db0,
+         0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9, 0x6f47, 0x8c15,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x52cb, 0x52cb, 0x525e, 0x525e, 0x525e, 0x525e, 0x525e, 0x525e,
+         0x525e, 0x525e, 0x5247, 0x5247, 0x5247, 0x51df, 0x51df, 0x51df,
+         0x51df, 0x51df, 0x51e2, 0x51e2, 0x525e, 0x6c15, 0x6d9a, 0x6db0,
+         0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9, 0x6f47, 0x8c15,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x52de, 0x52de, 0x52de, 0x52de, 0x52de, 0x52de, 0x52de, 0x52de,
+         0x52de, 0x52de, 0x52cb, 0x52cb, 0x52cb, 0x525e, 0x525e, 0x525e,
+         0x525e, 0x525e, 0x52de, 0x52e2, 0x535f, 0x69e1, 0x6d9a, 0x6db0,
+         0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9, 0x6f47, 0x89e1,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x5360, 0x5360, 0x5360, 0x5360, 0x5360, 0x5360, 0x5360, 0x5360,
+         0x5360, 0x5360, 0x52e0, 0x52de, 0x52de, 0x52de, 0x52de, 0x52e2,
+         0x52e2, 0x52e2, 0x5350, 0x534f, 0x535f, 0x69d6, 0x6a5a, 0x6ae2,
+         0x6ae3, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9, 0x6f47, 0x89d6,
+         0x8a5a, 0x8ae2, 0x8ae3, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x535f, 0x535f, 0x535f, 0x535f, 0x535f, 0x535f, 0x535f, 0x535f,
+         0x535f, 0x535f, 0x535f, 0x535f, 0x535f, 0x535f, 0x535f, 0x535f,
+         0x535f, 0x535f, 0x53d2, 0x53d2, 0x66d4, 0x69ce, 0x6a4f, 0x6ad6,
+         0x6ae3, 0x723c, 0x6b63, 0x71c2, 0x71c2, 0x71cd, 0x71ce, 0x89cc,
+         0x8a4f, 0x8ad6, 0x8ae3, 0x8b64, 0x8b63, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1,
+         0x53e1, 0x53e1, 0x53d2, 0x535f, 0x535f, 0x535f, 0x535f, 0x53e2,
+         0x53e2, 0x53e2, 0x53e2, 0x53d2, 0x66cc, 0x69cc, 0x6a4f, 0x6ad6,
+         0x6ae3, 0x6b64, 0x6b63, 0x7247, 0x7247, 0x72d8, 0x7252, 0x89c9,
+         0x8a4e, 0x8ad2, 0x8ae3, 0x8b64, 0x8b63, 0x8c59, 0x8c5a, 0x8ce1},
+        {0x53e2, 0x53e2, 0x53e2, 0x53e2, 0x53e2, 0x53e2, 0x53e2, 0x53e2,
+         0x53e2, 0x53e2, 0x53e1, 0x53e1, 0x53e2, 0x53e2, 0x53e2, 0x53e2,
+         0x5456, 0x5456, 0x5456, 0x5456, 0x66cc, 0x69ca, 0x6a4e, 0x6ad2,
+         0x6ae3, 0x6b64, 0x6b63, 0x6c63, 0x6c63, 0x72e0, 0x72d7, 0x89c9,
+         0x8a4e, 0x8ad2, 0x8ae3, 0x8b64, 0x8b63, 0x8c59, 0x8c5a, 0x8cdd},
+        {0x5464, 0x5464, 0x5464, 0x5464, 0x5464, 0x5464, 0x5464, 0x5464,
+         0x5464, 0x5464, 0x53e2, 0x53e2, 0x53e2, 0x4154, 0x5463, 0x5463,
+         0x4e61, 0x5456, 0x5456, 0x5456, 0x66cc, 0x69ca, 0x6a4e, 0x6ad2,
+         0x6b52, 0x6b64, 0x6bda, 0x6c63, 0x6c63, 0x72e0, 0x72de, 0x89c9,
+         0x8a4e, 0x8ad2, 0x8b52, 0x8b64, 0x8bd6, 0x8c59, 0x8c5a, 0x8cdd},
+        {0x5463, 0x5463, 0x5463, 0x5463, 0x5463, 0x5463, 0x5463, 0x5463,
+         0x5463, 0x5463, 0x5463, 0x5463, 0x5463, 0x5463, 0x555f, 0x5556,
+         0x525e, 0x51d7, 0x5463, 0x5463, 0x6ed4, 0x75cf, 0x7560, 0x7556,
+         0x74da, 0x8052, 0x7463, 0x803e, 0x803c, 0x8032, 0x8ed4, 0x95cf,
+         0x9560, 0x9556, 0x94da, 0xa05a, 0x9463, 0xa048, 0xa03e, 0xa03c},
+        {0x5560, 0x5560, 0x5560, 0x5560, 0x5560, 0x5560, 0x5560, 0x5560,
+         0x5560, 0x605a, 0x585f, 0x555f, 0x555f, 0x555f, 0x555f, 0x555f,
+         0x5556, 0x535f, 0x54da, 0x5463, 0x6ed4, 0x8c15, 0x8d9a, 0x8db0,
+         0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9, 0x8f47, 0xac15,
+         0xad9a, 0xadb0, 0xadb0, 0xae38, 0xae41, 0xae41, 0xaebf, 0xaec9},
+        {0x555f, 0x555f, 0x555f, 0x555f, 0x555f, 0x555f, 0x555f, 0x555f,
+         0x555f, 0x555f, 0x5662, 0x5660, 0x5660, 0x5656, 0x55da, 0x5656,
+         0x55da, 0x555f, 0x555f, 0x5660, 0x6d56, 0x8c15, 0x8d9a, 0x8db0,
+         0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9, 0x8f47, 0xac15,
+         0xad9a, 0xadb0, 0xadb0, 0xae38, 0xae41, 0xae41, 0xaebf, 0xaec9},
+        {0x5660, 0x5660, 0x5660, 0x5660, 0x5660, 0x5660, 0x5660, 0x5660,
+         0x6c15, 0x57db, 0x5662, 0x5660, 0x5660, 0x5660, 0x5656, 0x5656,
+         0x55da, 0x555f, 0x555f, 0x5660, 0x6ed4, 0x8c15, 0x8d9a, 0x8db0,
+         0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9, 0x8f47, 0xac15,
+         0xad9a, 0xadb0, 0xadb0, 0xae38, 0xae41, 0xae41, 0xaebf, 0xaec9},
+        {0x5660, 0x5660, 0x5660, 0x5660, 0x5660, 0x5660, 0x5660, 0x5660,
+         0x61e0, 0x57db, 0x5662, 0x5662, 0x5662, 0x5660, 0x5660, 0x5660,
+         0x5660, 0x5662, 0x5662, 0x5662, 0x6e61, 0x89e2, 0x8d9a, 0x8db0,
+         0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9, 0x8f47, 0xa9e2,
+         0xad9a, 0xadb0, 0xadb0, 0xae38, 0xae41, 0xae41, 0xaebf, 0xaec9},
+        {0x5662, 0x5662, 0x5662, 0x5662, 0x5662, 0x5662, 0x5662, 0x5662,
+         0x6050, 0x605c, 0x59e3, 0x58de, 0x56de, 0x5662, 0x5660, 0x5660,
+         0x5660, 0x603e, 0x603c, 0x6032, 0x6ee0, 0x89d6, 0x8a5a, 0x8ae2,
+         0x8ae3, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9, 0x8f47, 0xa9d6,
+         0xaa5a, 0xaae2, 0xaae3, 0xae38, 0xae41, 0xae41, 0xaebf, 0xaec9},
+        {0x64df, 0x64df, 0x6557, 0x6557, 0x64df, 0x64df, 0x64df, 0x64df,
+         0x64df, 0x64df, 0x64df, 0x59e3, 0x58de, 0x56de, 0x5662, 0x585f,
+         0x5662, 0x603e, 0x603c, 0x6032, 0x7162, 0x89ce, 0x8a4f, 0x8ad6,
+         0x8ae3, 0x8e38, 0x8b63, 0x8e41, 0x8ebf, 0x8ec9, 0x8f47, 0xa9ce,
+         0xaa4f, 0xaad6, 0xaae3, 0xae38, 0xab63, 0xae41, 0xaebf, 0xaec9},
+        {0x64df, 0x64df, 0x6557, 0x6557, 0x64df, 0x64df, 0x64df, 0x64df,
+         0x64df, 0x64df, 0x64df, 0x64e0, 0x6557, 0x6557, 0x6563, 0x6563,
+         0x6563, 0x6563, 0x6563, 0x64df, 0x71e2, 0x89c9, 0x8a4e, 0x8ad2,
+         0x8ae3, 0x8b64, 0x8b63, 0x8c59, 0x8c63, 0x8ce1, 0x8f47, 0xa9c9,
+         0xaa4e, 0xaad2, 0xaae3, 0xab64, 0xab63, 0xac59, 0xac63, 0xace1},
+        {0x64df, 0x64df, 0x64e0, 0x645f, 0x645f, 0x645e, 0x645e, 0x645e,
+         0x645e, 0x645e, 0x645e, 0x64d3, 0x64df, 0x64df, 0x64df, 0x64df,
+         0x64df, 0x645f, 0x645f, 0x645e, 0x72d7, 0x89c9, 0x8a4e, 0x8ad2,
+         0x8ae3, 0x8b64, 0x8b63, 0x8c59, 0x8c5a, 0x8cdd, 0x8cde, 0xa9c9,
+         0xaa4e, 0xaad2, 0xaae3, 0xab64, 0xab63, 0xac59, 0xac5a, 0xacdd},
+        {0x645e, 0x645e, 0x645f, 0x645f, 0x645e, 0x645e, 0x645c, 0x645c,
+         0x645c, 0x645c, 0x645c, 0x645c, 0x64d4, 0x64df, 0x64df, 0x64df,
+         0x64df, 0x645f, 0x645f, 0x645e, 0x72de, 0x89c9, 0x8a4e, 0x8ad2,
+         0x8ae3, 0x8b64, 0x8b63, 0x8c59, 0x8c5a, 0x8cdd, 0x8cde, 0xa9c9,
+         0xaa4e, 0xaad2, 0xaae3, 0xab64, 0xab63, 0xac59, 0xac5a, 0xacdd},
+    },
+    {
+        {0x6563, 0x6563, 0x803e, 0x803c, 0x6259, 0x6253, 0x6253, 0x6253,
+         0x6253, 0x6254, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253,
+         0x6253, 0x6254, 0x62c0, 0x62c0, 0x64e0, 0x64e0, 0x64e0, 0x64e0,
+         0x64e0, 0x64e0, 0x64e0, 0x64e0, 0x64e0, 0x64e0, 0x8558, 0x84e0,
+         0x855c, 0x8558, 0x85d1, 0x864d, 0x86cc, 0x89cc, 0x8ad5, 0x8b64},
+        {0x6563, 0x64df, 0x6564, 0x6658, 0x6153, 0x6152, 0x6152, 0x6152,
+         0x6152, 0x6153, 0x6152, 0x6152, 0x6152, 0x6152, 0x6152, 0x6152,
+         0x6152, 0x61b2, 0x61b2, 0x61b2, 0x645e, 0x645e, 0x645e, 0x645e,
+         0x645e, 0x645e, 0x645e, 0x645e, 0x645e, 0x645e, 0x845e, 0x84d3,
+         0x855c, 0x854e, 0x85c6, 0x8642, 0x86cc, 0x89ca, 0x845f, 0x8ad2},
+        {0x63e2, 0x645e, 0x645e, 0x65d2, 0x6050, 0x6046, 0x6046, 0x603e,
+         0x603c, 0x6032, 0x602a, 0x6028, 0x601e, 0x6014, 0x6006, 0x4663,
+         0x46df, 0x475e, 0x49e2, 0x6014, 0x645c, 0x645c, 0x645c, 0x645c,
+         0x645c, 0x645c, 0x645c, 0x645c, 0x645c, 0x645c, 0x845e, 0x845c,
+         0x84d4, 0x854c, 0x85c6, 0x8642, 0x86c0, 0x89c9, 0x845f, 0x8460},
+        {0x62de, 0x62de, 0x63da, 0x64df, 0x7dd8, 0x7c62, 0x7c62, 0x6663,
+         0x6762, 0x6663, 0x6663, 0x6663, 0x6663, 0x6663, 0x6663, 0x4663,
+         0x4663, 0x46df, 0x475e, 0x4663, 0x63da, 0x63da, 0x63da, 0x63da,
+         0x63da, 0x63da, 0x63da, 0x63da, 0x63da, 0x63da, 0x6ce2, 0x844e,
+         0x84d4, 0x84c6, 0x8542, 0x85bb, 0x86b6, 0x89c9, 0x83da, 0x83e2},
+        {0x61d6, 0x61d6, 0x61d6, 0x62d6, 0x7d5d, 0x7d52, 0x7cd8, 0x6663,
+         0x6664, 0x6663, 0x6663, 0x6663, 0x4563, 0x6563, 0x45de, 0x465b,
+         0x465a, 0x4563, 0x4563, 0x4563, 0x6357, 0x6357, 0x6357, 0x6357,
+         0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6cde, 0x8442,
+         0x8450, 0x8442, 0x84ba, 0x8536, 0x8638, 0x83e4, 0x8357, 0x835a},
+        {0x6052, 0x6046, 0x6046, 0x603e, 0x6563, 0x6563, 0x65de, 0x665b,
+         0x6563, 0x6563, 0x6563, 0x4663, 0x4563, 0x4563, 0x45de, 0x45de,
+         0x4563, 0x4563, 0x4563, 0x4563, 0x6357, 0x6357, 0x6357, 0x6357,
+         0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6cde, 0x83cc,
+         0x8444, 0x8440, 0x84b9, 0x8534, 0x862d, 0x835c, 0x8357, 0x8358},
+        {0x7e58, 0x7dce, 0x7d52, 0x7c47, 0x6563, 0x6563, 0x65de, 0x665b,
+         0x665a, 0x6563, 0x6563, 0x4563, 0x4563, 0x4563, 0x4563, 0x4563,
+         0x4563, 0x4563, 0x4563, 0x4563, 0x62d5, 0x62d5, 0x62d5, 0x62d5,
+         0x62d5, 0x62d5, 0x62d5, 0x62d5, 0x62d5, 0x62d5, 0x6d56, 0x8345,
+         0x83bc, 0x82de, 0x82e0, 0x84ac, 0x82de, 0x82d5, 0x82d6, 0x82d6},
+        {0x7d5d, 0x7d52, 0x7c56, 0x7b62, 0x6563, 0x6563, 0x6564, 0x65dd,
+         0x64e0, 0x4563, 0x4563, 0x44df, 0x455e, 0x4563, 0x4557, 0x4563,
+         0x44df, 0x44df, 0x44df, 0x4557, 0x6ed4, 0x6253, 0x6253, 0x6253,
+         0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x6254, 0x6dd2, 0x82c0,
+         0x8264, 0x825a, 0x8259, 0x8264, 0x825a, 0x8254, 0x8253, 0x8253},
+        {0x7d54, 0x7c5b, 0x61d6, 0x64df, 0x655e, 0x6243, 0x62c8, 0x65d2,
+         0x63cc, 0x6534, 0x4563, 0x44df, 0x44df, 0x455c, 0x44df, 0x44df,
+         0x44df, 0x44df, 0x44df, 0x44e0, 0x6f47, 0x6152, 0x6152, 0x6152,
+         0x6152, 0x6152, 0x6152, 0x6152, 0x6152, 0x61b2, 0x6dd2, 0x81b2,
+         0x81e0, 0x8153, 0x815e, 0x815e, 0x8153, 0x8153, 0x8152, 0x8152},
+        {0x6050, 0x6154, 0x6052, 0x6052, 0x6048, 0x603e, 0x6034, 0x6050,
+         0x6028, 0x6334, 0x44df, 0x445e, 0x44d3, 0x44df, 0x445f, 0x445f,
+         0x445e, 0x445e, 0x445e, 0x44d3, 0x44df, 0x44df, 0x44df, 0x44df,
+         0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x674a, 0x69ce,
+         0x6a4f, 0x6ad6, 0x6b5e, 0x664e, 0x6b63, 0x69ce, 0x6a4f, 0x6ad6},
+        {0x7ce4, 0x645f, 0x645f, 0x645e, 0x64d3, 0x64d3, 0x654e, 0x4663,
+         0x4663, 0x46df, 0x445f, 0x445e, 0x445c, 0x445f, 0x445e, 0x445e,
+         0x445e, 0x445c, 0x445c, 0x445c, 0x44e0, 0x44e0, 0x44e0, 0x44e0,
+         0x44e0, 0x44e0, 0x44e0, 0x44e0, 0x44e0, 0x44e0, 0x66cc, 0x69cc,
+         0x6ad5, 0x6b5c, 0x6b5c, 0x6b64, 0x66cc, 0x69cc, 0x6ad5, 0x6b64},
+        {0x6663, 0x6663, 0x645f, 0x645e, 0x645c, 0x64d3, 0x64d4, 0x4663,
+         0x4663, 0x46df, 0x445e, 0x4452, 0x43e2, 0x43e2, 0x43da, 0x43da,
+         0x43da, 0x444e, 0x444e, 0x444e, 0x445e, 0x445e, 0x445e, 0x445e,
+         0x445e, 0x445e, 0x445e, 0x445e, 0x445e, 0x445e, 0x66cc, 0x69ca,
+         0x6a4e, 0x6ad2, 0x6b52, 0x6b64, 0x6bda, 0x6c63, 0x6c63, 0x6ad2},
+        {0x6663, 0x6663, 0x6663, 0x6452, 0x4563, 0x4563, 0x45de, 0x465b,
+         0x465a, 0x465a, 0x43d9, 0x43ca, 0x435a, 0x435a, 0x4357, 0x4357,
+         0x4357, 0x43ca, 0x43ca, 0x4442, 0x445c, 0x445c, 0x445c, 0x445c,
+         0x445c, 0x445c, 0x445c, 0x445c, 0x445c, 0x445c, 0x66c0, 0x69c9,
+         0x6a4e, 0x6ad2, 0x6b52, 0x6bd8, 0x6bda, 0x6c63, 0x6c63, 0x6460},
+        {0x6243, 0x62c8, 0x6563, 0x63cc, 0x6443, 0x4563, 0x45de, 0x465b,
+         0x465a, 0x43e2, 0x4357, 0x435a, 0x435a, 0x4357, 0x4357, 0x4357,
+         0x4357, 0x4358, 0x43ca, 0x43cc, 0x43da, 0x43da, 0x43da, 0x43da,
+         0x43da, 0x43da, 0x43da, 0x43da, 0x43da, 0x43da, 0x4ce2, 0x69c9,
+         0x6abe, 0x6b43, 0x6b54, 0x6bd8, 0x6bd6, 0x6c5a, 0x6c5a, 0x6ec9},
+        {0x603e, 0x6034, 0x6050, 0x6028, 0x60db, 0x4563, 0x4564, 0x45dd,
+         0x4658, 0x42de, 0x42de, 0x42de, 0x42d6, 0x42d5, 0x42d5, 0x42d5,
+         0x4346, 0x4345, 0x4345, 0x4345, 0x4357, 0x4357, 0x4357, 0x4357,
+         0x4357, 0x4357, 0x4357, 0x4357, 0x4357, 0x4357, 0x4cde, 0x69e1,
+         0x6b37, 0x6b42, 0x6bc7, 0x6c54, 0x6c4b, 0x6c59, 0x6cd2, 0x6ce1},
+        {0x6563, 0x6563, 0x6563, 0x6563, 0x6563, 0x455e, 0x4557, 0x45d2,
+         0x45d2, 0x425a, 0x425a, 0x4259, 0x4253, 0x4253, 0x4253, 0x4254,
+         0x42c2, 0x42c0, 0x42c0, 0x42c0, 0x4357, 0x4357, 0x4357, 0x4357,
+         0x4357, 0x4357, 0x4357, 0x4357, 0x4357, 0x4357, 0x4cde, 0x69d6,
+         0x6a5a, 0x6ae2, 0x6ae3, 0x6c4c, 0x6c4b, 0x6cd1, 0x6cd2, 0x6cdd},
+        {0x64df, 0x64df, 0x64df, 0x64df, 0x64df, 0x455c, 0x4557, 0x4558,
+         0x45d1, 0x4153, 0x4153, 0x4153, 0x4152, 0x4152, 0x4152, 0x41c2,
+         0x41b6, 0x41b2, 0x41b2, 0x41b2, 0x42d5, 0x42d5, 0x42d5, 0x42d5,
+         0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x4d56, 0x69cc,
+         0x6a4f, 0x6ad6, 0x6ae3, 0x6b64, 0x6b63, 0x6cd0, 0x6cdd, 0x6cdd},
+        {0x635c, 0x445f, 0x603e, 0x603c, 0x6032, 0x44d3, 0x454e, 0x4558,
+         0x45c6, 0x4052, 0x403c, 0x4032, 0x402a, 0x4028, 0x401e, 0x4014,
+         0x4006, 0x24df, 0x4028, 0x401e, 0x4253, 0x4253, 0x4253, 0x4253,
+         0x4253, 0x4253, 0x4253, 0x4253, 0x4253, 0x4254, 0x4dd2, 0x69c9,
+         0x6a4e, 0x6ad2, 0x6ae3, 0x6b64, 0x6b63, 0x6c59, 0x6c5a, 0x6ce1},
+        {0x62d5, 0x445f, 0x445f, 0x44df, 0x6014, 0x44d3, 0x44d4, 0x454c,
+         0x45c6, 0x5de4, 0x5d48, 0x5162, 0x5164, 0x5162, 0x5c2d, 0x5b2c,
+         0x5a17, 0x24df, 0x24df, 0x4014, 0x4152, 0x4bd6, 0x4152, 0x4152,
+         0x4152, 0x4152, 0x4152, 0x4152, 0x4152, 0x41b2, 0x4dd2, 0x69c9,
+         0x6a4e, 0x6ad2, 0x6ae4, 0x6b64, 0x6b63, 0x6c59, 0x6c5a, 0x6cdd},
+        {0x61d4, 0x43da, 0x43da, 0x43e2, 0x455e, 0x444e, 0x44c6, 0x4542,
+         0x4542, 0x5dd8, 0x5ccc, 0x5162, 0x5162, 0x5162, 0x5bb4, 0x5b2c,
+         0x245f, 0x245e, 0x23e2, 0x24df, 0x2557, 0x2557, 0x25d2, 0x264e,
+         0x26d4, 0x29ce, 0x2a4f, 0x2ad6, 0x2ae3, 0x2b63, 0x4e4e, 0x49ce,
+         0x4a4f, 0x4ad6, 0x4ae3, 0x6dbc, 0x4b63, 0x6dc5, 0x6dc6, 0x6e4c},
+        {0x43e4, 0x4357, 0x4357, 0x405c, 0x4443, 0x4443, 0x4442, 0x44ba,
+         0x44ba, 0x5d5d, 0x5ccc, 0x5162, 0x5162, 0x23e2, 0x23e2, 0x23e2,
+         0x23da, 0x2452, 0x205c, 0x244e, 0x24c6, 0x24c6, 0x2542, 0x25bb,
+         0x26b6, 0x29c9, 0x2a4e, 0x23e2, 0x23e2, 0x2b63, 0x4ed4, 0x49c9,
+         0x4a4e, 0x4ad2, 0x4ae3, 0x4b64, 0x4b63, 0x4c59, 0x4c5a, 0x4cdd},
+        {0x435c, 0x4357, 0x4357, 0x4358, 0x43cc, 0x4443, 0x4440, 0x4440,
+         0x44b9, 0x5d52, 0x51c2, 0x5162, 0x5162, 0x23e2, 0x23e2, 0x23e2,
+         0x23da, 0x23d9, 0x2451, 0x244e, 0x244e, 0x24c6, 0x2540, 0x25bb,
+         0x2638, 0x29c9, 0x2a4e, 0x23e2, 0x23e2, 0x23e4, 0x4ed4, 0x49c9,
+         0x4a4e, 0x4ad2, 0x4ae3, 0x4b64, 0x4b63, 0x4c59, 0x4c5a, 0x4cdd},
+        {0x42d5, 0x42d5, 0x434d, 0x4346, 0x4345, 0x43bb, 0x43ba, 0x4432,
+         0x4432, 0x5ce4, 0x51c2, 0x5162, 0x5162, 0x235a, 0x235a, 0x235a,
+         0x2357, 0x2357, 0x23ca, 0x23ca, 0x2442, 0x2442, 0x24ba, 0x2536,
+         0x2638, 0x29c9, 0x2a4e, 0x235a, 0x235a, 0x23e4, 0x2ce2, 0x4c15,
+         0x4d9a, 0x4db0, 0x4db0, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9},
+        {0x4254, 0x4254, 0x42c8, 0x42c2, 0x42c0, 0x4335, 0x4333, 0x4334,
+         0x43ab, 0x5cda, 0x51c2, 0x22de, 0x22de, 0x22d6, 0x22d6, 0x22d6,
+         0x22d6, 0x2346, 0x2346, 0x2346, 0x23ba, 0x23ba, 0x2432, 0x252a,
+         0x2622, 0x22de, 0x22de, 0x22d6, 0x22d6, 0x235c, 0x2cde, 0x4c15,
+         0x4d9a, 0x4db0, 0x4db0, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9},
+        {0x41d4, 0x41c2, 0x41c2, 0x41b6, 0x41b2, 0x41b2, 0x4223, 0x4222,
+         0x4222, 0x5cda, 0x51c2, 0x22de, 0x22de, 0x22d6, 0x22d6, 0x22d5,
+         0x22d5, 0x22d5, 0x22d5, 0x22d5, 0x2345, 0x2358, 0x23ba, 0x24ac,
+         0x25a5, 0x22de, 0x22de, 0x22d6, 0x22d5, 0x22d5, 0x2cde, 0x49e2,
+         0x4d9a, 0x4db0, 0x4db0, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9},
+        {0x4048, 0x403e, 0x403c, 0x4032, 0x402a, 0x4028, 0x401e, 0x4014,
+         0x4006, 0x21e2, 0x21e2, 0x21d6, 0x21d6, 0x21d2, 0x21d2, 0x21d2,
+         0x21d2, 0x21d2, 0x21d2, 0x21d2, 0x223a, 0x2253, 0x21e2, 0x21e2,
+         0x21e2, 0x21d6, 0x21d6, 0x21d2, 0x21d2, 0x2254, 0x2dd2, 0x49d6,
+         0x4a5a, 0x4ae2, 0x4ae3, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9},
+        {0x5d54, 0x5d54, 0x5d48, 0x44df, 0x455e, 0x455e, 0x4557, 0x45d2,
+         0x45d2, 0x20db, 0x20db, 0x20d2, 0x20d2, 0x20d2, 0x20d2, 0x20d2,
+         0x20d2, 0x20d2, 0x20d2, 0x20d2, 0x20d2, 0x20d2, 0x20d2, 0x20d2,
+         0x20db, 0x20d2, 0x20d2, 0x20d2, 0x20d2, 0x2151, 0x2e4e, 0x49ce,
+         0x4a4f, 0x4ad6, 0x4ae3, 0x4e38, 0x4b63, 0x4e41, 0x4ebf, 0x4ec9},
+        {0x5cd8, 0x5cd8, 0x5ccc, 0x44df, 0x44e0, 0x455c, 0x4557, 0x4558,
+         0x45d1, 0x205a, 0x205a, 0x2052, 0x2050, 0x2046, 0x2046, 0x2046,
+         0x203e, 0x2032, 0x2032, 0x202a, 0x201e, 0x201e, 0x200a, 0x2002,
+         0x2002, 0x2052, 0x2050, 0x2046, 0x2046, 0x2048, 0x2ed4, 0x49c9,
+         0x4a4e, 0x4ad2, 0x4ae3, 0x4b64, 0x4b63, 0x4c59, 0x4c63, 0x4ce1},
+        {0x5cd8, 0x4357, 0x4357, 0x43ca, 0x4443, 0x4443, 0x4442, 0x44ba,
+         0x44ba, 0x3e5f, 0x3de4, 0x3de4, 0x3dd8, 0x235a, 0x235a, 0x235a,
+         0x2357, 0x2357, 0x2357, 0x23ca, 0x2442, 0x2442, 0x24ba, 0x2536,
+         0x26ab, 0x29c9, 0x2a4e, 0x235a, 0x235a, 0x2bd6, 0x2cde, 0x49c9,
+         0x4a4e, 0x4ad2, 0x4ae3, 0x4b64, 0x4b63, 0x4c59, 0x4c5a, 0x4cdd},
+        {0x42d5, 0x42ca, 0x42ca, 0x42c2, 0x4336, 0x4336, 0x4333, 0x43ab,
+         0x43ab, 0x3de3, 0x3de3, 0x3dda, 0x3d5d, 0x23e2, 0x23e2, 0x235c,
+         0x235c, 0x2358, 0x2358, 0x2358, 0x23cc, 0x2440, 0x2440, 0x2534,
+         0x262d, 0x29c9, 0x2a4e, 0x23e2, 0x235c, 0x235c, 0x2ce2, 0x49c9,
+         0x4a4e, 0x4ad2, 0x4ae3, 0x4b64, 0x4b63, 0x4c59, 0x4c5a, 0x4cdd},
+    },
+    {
+        {0x82d5, 0x82d5, 0x834d, 0x8346, 0x8345, 0x83bb, 0x83ba, 0x8432,
+         0x8432, 0x835a, 0x835c, 0x8357, 0x8357, 0x8358, 0x64e0, 0x655c,
+         0x6558, 0x6558, 0x65d1, 0x62d6, 0x62d5, 0x62d5, 0x634d, 0x6346,
+         0x6345, 0x63bb, 0x63ba, 0x6432, 0x6432, 0x6046, 0x44e0, 0x44e0,
+         0x44e0, 0x44e0, 0x44e0, 0x44e0, 0x44e0, 0x44e0, 0x44e0, 0x44e0},
+        {0x8254, 0x8254, 0x82c8, 0x82c2, 0x82c0, 0x8335, 0x8333, 0x8334,
+         0x83ab, 0x82d6, 0x82d5, 0x645f, 0x645f, 0x645e, 0x64d3, 0x64d3,
+         0x654e, 0x6558, 0x65c6, 0x6253, 0x6254, 0x6254, 0x62c8, 0x62c2,
+         0x62c0, 0x6335, 0x6333, 0x6334, 0x63ab, 0x7510, 0x445e, 0x445e,
+         0x445e, 0x445e, 0x445e, 0x445e, 0x445e, 0x445e, 0x445e, 0x445e},
+        {0x81d4, 0x81c2, 0x81c2, 0x81b6, 0x81b2, 0x81b2, 0x8223, 0x8222,
+         0x8222, 0x8253, 0x8254, 0x645f, 0x645f, 0x645e, 0x645c, 0x64d3,
+         0x64d4, 0x654c, 0x65c6, 0x6152, 0x61d4, 0x61c2, 0x61c2, 0x61b6,
+         0x61b2, 0x61b2, 0x6223, 0x6222, 0x6222, 0x7510, 0x445c, 0x445c,
+         0x445c, 0x445c, 0x445c, 0x445c, 0x445c, 0x445c, 0x445c, 0x445c},
+        {0x8048, 0x803e, 0x803c, 0x8032, 0x802a, 0x8028, 0x801e, 0x8014,
+         0x8006, 0x63e2, 0x81d4, 0x63da, 0x63da, 0x6452, 0x644e, 0x644e,
+         0x64c6, 0x6542, 0x6542, 0x6046, 0x6048, 0x603e, 0x603c, 0x6032,
+         0x602a, 0x6028, 0x601e, 0x6014, 0x6006, 0x43e2, 0x43da, 0x43da,
+         0x43da, 0x43da, 0x43da, 0x43da, 0x43da, 0x43da, 0x43da, 0x43da},
+        {0x9d54, 0x9d54, 0x9d48, 0x9b62, 0x9ada, 0x9ada, 0x9a57, 0x8663,
+         0x8663, 0x635a, 0x63e4, 0x6357, 0x6357, 0x63ca, 0x6443, 0x6443,
+         0x6442, 0x64ba, 0x64ba, 0x7dce, 0x7d54, 0x7d54, 0x7d48, 0x7b62,
+         0x7ada, 0x7ada, 0x7a57, 0x6663, 0x6663, 0x435a, 0x4357, 0x4357,
+         0x4357, 0x4357, 0x4357, 0x4357, 0x4357, 0x4357, 0x4357, 0x4357},
+        {0x9cd8, 0x9cd8, 0x9ccc, 0x9cc2, 0x8563, 0x8563, 0x85de, 0x865b,
+         0x865a, 0x635a, 0x635c, 0x6357, 0x6357, 0x6358, 0x63cc, 0x6443,
+         0x6440, 0x6440, 0x64b9, 0x7d52, 0x7cd8, 0x7cd8, 0x7ccc, 0x7cc2,
+         0x6563, 0x6563, 0x65de, 0x665b, 0x665a, 0x435a, 0x4357, 0x4357,
+         0x4357, 0x4357, 0x4357, 0x4357, 0x4357, 0x4357, 0x4357, 0x4357},
+        {0x9cd8, 0x9cce, 0x9ccc, 0x84df, 0x855e, 0x855e, 0x8557, 0x85d2,
+         0x85d2, 0x62d6, 0x62d5, 0x62d5, 0x634d, 0x6346, 0x6345, 0x63bb,
+         0x63ba, 0x6432, 0x6432, 0x7d52, 0x7cd8, 0x7cce, 0x7ccc, 0x64df,
+         0x655e, 0x655e, 0x6557, 0x65d2, 0x4663, 0x42d6, 0x42d5, 0x42d5,
+         0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x42d5},
+        {0x9cd8, 0x845f, 0x845f, 0x845e, 0x84d3, 0x84d3, 0x854e, 0x8558,
+         0x85c6, 0x6253, 0x6254, 0x6254, 0x62c8, 0x62c2, 0x62c0, 0x6335,
+         0x6333, 0x6334, 0x63ab, 0x7cda, 0x645f, 0x645f, 0x645e, 0x645e,
+         0x645e, 0x645e, 0x64d3, 0x645f, 0x654e, 0x4253, 0x4253, 0x4253,
+         0x4253, 0x4253, 0x4253, 0x4253, 0x4253, 0x4253, 0x4253, 0x4253},
+        {0x835c, 0x8357, 0x8357, 0x8358, 0x83cc, 0x8443, 0x8440, 0x8440,
+         0x84b9, 0x6152, 0x61d4, 0x61c2, 0x61c2, 0x61b6, 0x61b2, 0x61b2,
+         0x6223, 0x6222, 0x6222, 0x635a, 0x635c, 0x6357, 0x6357, 0x6358,
+         0x63cc, 0x6443, 0x6440, 0x63e2, 0x445c, 0x4152, 0x4152, 0x4152,
+         0x4152, 0x4152, 0x4152, 0x4152, 0x4152, 0x4152, 0x4152, 0x4152},
+        {0x8048, 0x803e, 0x803c, 0x84df, 0x855e, 0x855e, 0x8557, 0x85d2,
+         0x85d2, 0x6046, 0x6048, 0x603e, 0x603c, 0x6032, 0x602a, 0x6028,
+         0x601e, 0x6014, 0x6006, 0x4052, 0x405a, 0x4050, 0x4046, 0x403e,
+         0x403c, 0x403c, 0x4032, 0x402a, 0x4032, 0x4046, 0x4006, 0x2563,
+         0x2563, 0x25de, 0x265b, 0x265a, 0x26d6, 0x2953, 0x2a5a, 0x2ae2},
+        {0x8254, 0x8254, 0x82c8, 0x82c2, 0x82c0, 0x8335, 0x8333, 0x8334,
+         0x83ab, 0x6152, 0x61d4, 0x61c2, 0x61c2, 0x61b6, 0x61b2, 0x61b2,
+         0x6223, 0x6222, 0x6222, 0x4052, 0x405a, 0x4050, 0x4046, 0x403e,
+         0x403c, 0x403c, 0x4032, 0x402a, 0x4032, 0x4016, 0x521a, 0x2563,
+         0x2563, 0x25de, 0x265b, 0x265a, 0x26d6, 0x2953, 0x2a5a, 0x2ae2},
+        {0x81d4, 0x81c2, 0x81c2, 0x81b6, 0x81b2, 0x81b2, 0x8223, 0x8222,
+         0x8222, 0x6046, 0x6048, 0x603e, 0x603c, 0x6032, 0x602a, 0x6028,
+         0x601e, 0x6014, 0x6006, 0x5dda, 0x5dd8, 0x5d52, 0x5d52, 0x5d47,
+         0x5d47, 0x5cc2, 0x5c3a, 0x5cb4, 0x5c2e, 0x5a32, 0x55ae, 0x2563,
+         0x2563, 0x25dd, 0x25dd, 0x2658, 0x26d4, 0x2953, 0x2a5a, 0x2ae0},
+        {0x8048, 0x803e, 0x803c, 0x8032, 0x802a, 0x8028, 0x801e, 0x8014,
+         0x8006, 0x7d5a, 0x7cd9, 0x7cce, 0x7c54, 0x7c47, 0x7c3e, 0x7bc4,
+         0x7b3c, 0x7ab5, 0x79a3, 0x5d5e, 0x5ce4, 0x5ce4, 0x5cd8, 0x5cce,
+         0x5c54, 0x5c47, 0x5c3e, 0x5bc1, 0x5ac7, 0x5956, 0x24df, 0x255e,
+         0x255e, 0x2557, 0x25d2, 0x264e, 0x26ca, 0x294a, 0x2a4f, 0x24df},
+        {0x9d54, 0x9bde, 0x9bde, 0x9b5b, 0x9b4b, 0x9b4b, 0x9ac7, 0x9a42,
+         0x9936, 0x7c62, 0x7c61, 0x7bde, 0x7bdd, 0x7b5b, 0x7b4b, 0x7b4b,
+         0x7ac7, 0x7a42, 0x7933, 0x5d5e, 0x5c62, 0x5c62, 0x5bde, 0x5bde,
+         0x5b5b, 0x5b4b, 0x5b4b, 0x5ac7, 0x5a57, 0x573e, 0x24df, 0x24e0,
+         0x255c, 0x2557, 0x2558, 0x25d1, 0x26ca, 0x294a, 0x2a4f, 0x24df},
+        {0x9cd8, 0x9bde, 0x9bde, 0x9b5b, 0x9ada, 0x9ad9, 0x9a57, 0x8663,
+         0x8663, 0x7c62, 0x7c61, 0x7bde, 0x7bdd, 0x7b5b, 0x7ada, 0x7ad9,
+         0x7a57, 0x6663, 0x6663, 0x5d5d, 0x5ce4, 0x5c62, 0x4052, 0x405a,
+         0x5b5b, 0x5ada, 0x5ad9, 0x5a57, 0x245f, 0x245f, 0x245e, 0x24d3,
+         0x24d3, 0x254e, 0x2558, 0x25d1, 0x26c2, 0x245f, 0x245f, 0x245e},
+        {0x9cd8, 0x9bde, 0x9bde, 0x9b5b, 0x8563, 0x8563, 0x85de, 0x865b,
+         0x865a, 0x7c62, 0x7cd8, 0x7bde, 0x7bde, 0x7b5b, 0x6563, 0x6563,
+         0x65de, 0x665b, 0x665a, 0x5d5d, 0x5ce4, 0x51e4, 0x5162, 0x5bc1,
+         0x5940, 0x51c2, 0x5162, 0x5164, 0x245f, 0x245f, 0x245e, 0x245c,
+         0x24d3, 0x254c, 0x254c, 0x25c8, 0x26c0, 0x245f, 0x245f, 0x245e},
+        {0x9cd8, 0x9c56, 0x9c54, 0x84df, 0x855e, 0x855e, 0x8557, 0x85d2,
+         0x6663, 0x7cda, 0x7c61, 0x7bde, 0x7bdd, 0x64df, 0x655e, 0x655e,
+         0x6557, 0x65d2, 0x65d2, 0x5ce4, 0x5cd8, 0x5c62, 0x5bcf, 0x5ad9,
+         0x5c62, 0x4357, 0x23e2, 0x23e2, 0x23da, 0x23da, 0x2452, 0x244e,
+         0x244e, 0x24c6, 0x2542, 0x23e2, 0x23e2, 0x23da, 0x23da, 0x23da},
+        {0x9c61, 0x845f, 0x845f, 0x845e, 0x84d3, 0x84d3, 0x854e, 0x84d3,
+         0x85d1, 0x7c62, 0x7c61, 0x645f, 0x645f, 0x645e, 0x64d3, 0x64d3,
+         0x654e, 0x64d3, 0x65d1, 0x435a, 0x5c56, 0x5c5b, 0x5b5b, 0x6028,
+         0x5c62, 0x51c2, 0x5162, 0x235a, 0x2357, 0x2357, 0x23ca, 0x23d9,
+         0x2443, 0x2442, 0x24ba, 0x235a, 0x235a, 0x2357, 0x2357, 0x23ca},
+        {0x835c, 0x8357, 0x8357, 0x8358, 0x83cc, 0x8443, 0x8440, 0x83e2,
+         0x645c, 0x7c62, 0x7c61, 0x645f, 0x645f, 0x645e, 0x645c, 0x64d3,
+         0x64d4, 0x63e2, 0x64c6, 0x4253, 0x42d5, 0x42de, 0x4358, 0x44e0,
+         0x5c62, 0x4243, 0x4253, 0x42c2, 0x235a, 0x2357, 0x2357, 0x2357,
+         0x23ca, 0x2440, 0x2440, 0x235a, 0x235a, 0x2357, 0x2357, 0x2357},
+        {0x605a, 0x6052, 0x6064, 0x6050, 0x605a, 0x605c, 0x6052, 0x605a,
+         0x64df, 0x63e2, 0x7c61, 0x63da, 0x405a, 0x6452, 0x644e, 0x644e,
+         0x64c6, 0x4046, 0x62d6, 0x41d2, 0x41d4, 0x4264, 0x4244, 0x4346,
+         0x4064, 0x403e, 0x4034, 0x20db, 0x4028, 0x22d6, 0x22d5, 0x22d6,
+         0x22de, 0x22de, 0x22de, 0x22d6, 0x22d5, 0x22d5, 0x22d5, 0x22d6},
+        {0x6153, 0x6052, 0x6064, 0x6050, 0x605a, 0x605a, 0x6052, 0x605a,
+         0x6050, 0x602a, 0x6046, 0x40db, 0x405a, 0x40d2, 0x40db, 0x4154,
+         0x40d2, 0x4046, 0x403e, 0x405c, 0x405c, 0x405c, 0x405a, 0x5eb6,
+         0x5c62, 0x5247, 0x3de4, 0x403e, 0x403c, 0x2253, 0x2253, 0x2253,
+         0x2253, 0x225a, 0x2259, 0x2253, 0x2253, 0x2253, 0x2253, 0x2253},
+        {0x6050, 0x6046, 0x6046, 0x603e, 0x7de3, 0x7de3, 0x7e5a, 0x7dda,
+         0x7dd8, 0x7a5e, 0x7d52, 0x5de3, 0x5de4, 0x5dda, 0x5de3, 0x5dd8,
+         0x5e60, 0x5dce, 0x5dc3, 0x5dc4, 0x5d54, 0x5d3c, 0x5cb4, 0x5bcf,
+         0x5a2e, 0x54c4, 0x5360, 0x52a5, 0x5247, 0x2152, 0x2152, 0x2152,
+         0x2152, 0x2152, 0x2153, 0x2152, 0x2152, 0x2152, 0x2152, 0x2152},
+        {0x7ce4, 0x7ce4, 0x7cd9, 0x7cce, 0x7c54, 0x7c47, 0x7c3e, 0x7c47,
+         0x7ac7, 0x79d6, 0x76b6, 0x7414, 0x5de3, 0x4064, 0x5e5f, 0x5de4,
+         0x5de4, 0x5d52, 0x5d47, 0x5d52, 0x5cc2, 0x5cce, 0x5bc1, 0x5b5b,
+         0x59d6, 0x55b0, 0x549e, 0x53e2, 0x52de, 0x2046, 0x2032, 0x202a,
+         0x2028, 0x201e, 0x2014, 0x2006, 0x2002, 0x203e, 0x203c, 0x2032},
+        {0x7d5d, 0x7cda, 0x7c61, 0x7c56, 0x7bdd, 0x7bcf, 0x7bc2, 0x7b5c,
+         0x7ac8, 0x79d9, 0x7933, 0x749e, 0x4064, 0x4064, 0x5de3, 0x5de4,
+         0x5dda, 0x5d5a, 0x5cce, 0x5ce4, 0x5c47, 0x5c3e, 0x5b5c, 0x5a57,
+         0x5958, 0x5638, 0x5526, 0x54aa, 0x53d2, 0x3dce, 0x3d3e, 0x3154,
+         0x3156, 0x315e, 0x315e, 0x315e, 0x31a6, 0x313b, 0x313b, 0x313b},
+        {0x7d5e, 0x7c62, 0x7c61, 0x7c5b, 0x7bdd, 0x7bdd, 0x7bd0, 0x7b4b,
+         0x7ac7, 0x7a42, 0x7936, 0x7526, 0x4064, 0x4064, 0x5de3, 0x5ce4,
+         0x5d5e, 0x5cd9, 0x5c56, 0x5c54, 0x5bcf, 0x5b5b, 0x5ac7, 0x5a42,
+         0x5a47, 0x56b6, 0x55ae, 0x54b8, 0x543c, 0x3d52, 0x3cc2, 0x31df,
+         0x31df, 0x31e2, 0x31e2, 0x31e2, 0x349d, 0x332e, 0x32b8, 0x31df},
+        {0x7ce4, 0x7c62, 0x7c62, 0x7c56, 0x7be0, 0x7bcf, 0x7b4b, 0x7ada,
+         0x7ac7, 0x7a42, 0x7933, 0x75ae, 0x4064, 0x4064, 0x5de3, 0x5de4,
+         0x5d5e, 0x5c61, 0x5c5b, 0x5bdd, 0x5bde, 0x5b5b, 0x5ad9, 0x5a58,
+         0x59d8, 0x56c9, 0x5638, 0x4663, 0x4663, 0x3ce4, 0x3c47, 0x325d,
+         0x325e, 0x3b3b, 0x3a42, 0x38da, 0x3526, 0x3430, 0x33b5, 0x333e},
+        {0x7de3, 0x7ce4, 0x7c61, 0x7bde, 0x7bdd, 0x7b5b, 0x7b56, 0x7ada,
+         0x64df, 0x64df, 0x64df, 0x64df, 0x4064, 0x4064, 0x5de3, 0x5de4,
+         0x5c62, 0x5d5e, 0x5c5b, 0x5c62, 0x5bd2, 0x5ada, 0x5a5e, 0x44df,
+         0x455e, 0x455e, 0x4557, 0x45d2, 0x45d2, 0x3cda, 0x3bcf, 0x32e2,
+         0x32e2, 0x3ac7, 0x2663, 0x26df, 0x275e, 0x295e, 0x343c, 0x33c4},
+        {0x7de3, 0x7c62, 0x7c62, 0x7c5b, 0x7c5b, 0x7bd2, 0x7b4b, 0x7a5e,
+         0x64df, 0x64df, 0x64df, 0x64df, 0x4064, 0x4064, 0x5de3, 0x5de4,
+         0x5d5e, 0x5d5e, 0x5ce4, 0x5bde, 0x5c61, 0x5b5b, 0x5ada, 0x44df,
+         0x44e0, 0x455c, 0x4557, 0x4558, 0x45d1, 0x3c62, 0x3bcf, 0x32e2,
+         0x32e2, 0x3a57, 0x2663, 0x2664, 0x275c, 0x295e, 0x34b6, 0x343e},
+        {0x7de3, 0x7d5e, 0x7c62, 0x7ce4, 0x635a, 0x635a, 0x6357, 0x6357,
+         0x6357, 0x6357, 0x6357, 0x6357, 0x4064, 0x4064, 0x5de3, 0x5de4,
+         0x5d5e, 0x5d5e, 0x5bde, 0x435a, 0x5b5b, 0x4357, 0x4357, 0x43ca,
+         0x4443, 0x4443, 0x4442, 0x44ba, 0x44ba, 0x3c62, 0x3b5b, 0x2563,
+         0x2563, 0x25de, 0x265b, 0x265a, 0x26d6, 0x2953, 0x2a5a, 0x2ae2},
+        {0x7de3, 0x625a, 0x625a, 0x625a, 0x6253, 0x6253, 0x6253, 0x6253,
+         0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x5de3, 0x5de4,
+         0x425a, 0x425a, 0x42e0, 0x4253, 0x42d5, 0x42ca, 0x42ca, 0x42c2,
+         0x4336, 0x4336, 0x4333, 0x43ab, 0x43ab, 0x4253, 0x3b5b, 0x2563,
+         0x2563, 0x25de, 0x265b, 0x265a, 0x26d6, 0x2953, 0x2a5a, 0x2ae2},
+    },
+    {
+        {0x4048, 0x403e, 0x403c, 0x4032, 0x402a, 0x4028, 0x401e, 0x4014,
+         0x4006, 0x235a, 0x2346, 0x23ba, 0x23ba, 0x2432, 0x22de, 0x22de,
+         0x22d6, 0x22d6, 0x22d6, 0x234e, 0x2cde, 0x4c15, 0x4d9a, 0x4db0,
+         0x4db0, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9, 0x4f47, 0x6c15,
+         0x6d9a, 0x6db0, 0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x5d54, 0x5d47, 0x5d47, 0x5cc2, 0x5c3a, 0x5c3a, 0x5c2d, 0x5b2c,
+         0x59a2, 0x22d6, 0x22d5, 0x2345, 0x2358, 0x23ba, 0x22de, 0x22de,
+         0x22d6, 0x22d5, 0x22d5, 0x22d5, 0x2cde, 0x4c15, 0x4d9a, 0x4db0,
+         0x4db0, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9, 0x4f47, 0x6c15,
+         0x6d9a, 0x6db0, 0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x5cd8, 0x5c56, 0x5c54, 0x5bcf, 0x5bc2, 0x5bc1, 0x5b3b, 0x5ab5,
+         0x5933, 0x21d2, 0x21d2, 0x21e2, 0x21e2, 0x21e2, 0x21d6, 0x21d6,
+         0x21d2, 0x21d2, 0x21d2, 0x2243, 0x2d56, 0x4c15, 0x4d9a, 0x4db0,
+         0x4db0, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9, 0x4f47, 0x6c15,
+         0x6d9a, 0x6db0, 0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x5c61, 0x5bde, 0x5bdd, 0x5b5b, 0x5b4b, 0x5b4b, 0x5ac7, 0x5a42,
+         0x5933, 0x20d2, 0x20d2, 0x20d2, 0x20d2, 0x20d2, 0x20d2, 0x20d2,
+         0x20d2, 0x20d2, 0x20d2, 0x213e, 0x2ddc, 0x4c15, 0x4d9a, 0x4db0,
+         0x4db0, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9, 0x4f47, 0x6c15,
+         0x6d9a, 0x6db0, 0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x5c61, 0x5bde, 0x5bdd, 0x5b5b, 0x5ada, 0x5ad9, 0x5a57, 0x4663,
+         0x4663, 0x2046, 0x202a, 0x201e, 0x201e, 0x200a, 0x2002, 0x2002,
+         0x2046, 0x2046, 0x203e, 0x203e, 0x2ed4, 0x49e1, 0x4d9a, 0x4db0,
+         0x4db0, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9, 0x4f47, 0x69e1,
+         0x6d9a, 0x6db0, 0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x5c61, 0x5bde, 0x5bdd, 0x5b5b, 0x4563, 0x4563, 0x45de, 0x465b,
+         0x465a, 0x3d52, 0x31cd, 0x3162, 0x3162, 0x3162, 0x3162, 0x3162,
+         0x3162, 0x3162, 0x3162, 0x3162, 0x3162, 0x49d6, 0x4a5a, 0x4ae2,
+         0x4ae3, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9, 0x4f47, 0x69d6,
+         0x6a5a, 0x6ae2, 0x6ae3, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x5c61, 0x5bde, 0x5bdd, 0x44df, 0x455e, 0x455e, 0x4557, 0x45d2,
+         0x45d2, 0x3ce4, 0x32d8, 0x31df, 0x31df, 0x31df, 0x31df, 0x31e2,
+         0x31e2, 0x31e2, 0x325e, 0x3247, 0x31df, 0x49cc, 0x4a4f, 0x4ad6,
+         0x4ae3, 0x4b64, 0x4b63, 0x4e41, 0x4ebf, 0x4ec9, 0x4f47, 0x69cc,
+         0x6a4f, 0x6ad6, 0x6ae3, 0x6b64, 0x6b63, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x5c61, 0x445f, 0x445f, 0x445e, 0x44d3, 0x44d3, 0x454e, 0x4558,
+         0x45c6, 0x3cda, 0x32e0, 0x325e, 0x325e, 0x325e, 0x325e, 0x3526,
+         0x342f, 0x33b6, 0x333e, 0x32cb, 0x32d7, 0x49c9, 0x4a4e, 0x4ad2,
+         0x4ae3, 0x4b64, 0x4b63, 0x4c59, 0x4c5a, 0x4ce1, 0x4cde, 0x69c9,
+         0x6a4e, 0x6ad2, 0x6ae3, 0x6b64, 0x6b63, 0x6c59, 0x6c5a, 0x6ce1},
+        {0x435c, 0x4357, 0x4357, 0x4358, 0x43cc, 0x4443, 0x4440, 0x4440,
+         0x44b9, 0x3c62, 0x32e0, 0x32de, 0x32de, 0x32e2, 0x32e2, 0x3531,
+         0x34b8, 0x343c, 0x33c4, 0x334f, 0x335f, 0x49c9, 0x4a4e, 0x4ad2,
+         0x4ae3, 0x4b64, 0x4b63, 0x4c59, 0x4c5a, 0x4cdd, 0x4cde, 0x69c9,
+         0x6a4e, 0x6ad2, 0x6ae3, 0x6b64, 0x6b63, 0x6c59, 0x6c5a, 0x6cdd},
+        {0x4254, 0x4254, 0x42c8, 0x42c2, 0x42c0, 0x4335, 0x4333, 0x4334,
+         0x43ab, 0x3c62, 0x3360, 0x335f, 0x335f, 0x3956, 0x385f, 0x353d,
+         0x353d, 0x34c2, 0x3449, 0x33d2, 0x451c, 0x49c9, 0x4a4e, 0x4ad2,
+         0x4b52, 0x4b64, 0x4bd6, 0x4c59, 0x4c5a, 0x4cdd, 0x4cde, 0x69c9,
+         0x6a4e, 0x6ad2, 0x6b52, 0x6b64, 0x6bd6, 0x6c59, 0x6c5a, 0x6cdd},
+        {0x755f, 0x755f, 0x755f, 0x5b62, 0x5ada, 0x5ada, 0x5a57, 0x59d6,
+         0x58da, 0x5598, 0x3b4b, 0x335f, 0x335f, 0x3956, 0x385f, 0x35c4,
+         0x3548, 0x34c2, 0x34c3, 0x344a, 0x4ed4, 0x55cf, 0x5560, 0x5556,
+         0x54da, 0x6052, 0x5463, 0x603e, 0x603c, 0x6032, 0x6ed4, 0x75cf,
+         0x7560, 0x7556, 0x74da, 0x805a, 0x7463, 0x8048, 0x803e, 0x803c},
+        {0x7162, 0x7162, 0x7162, 0x7162, 0x7162, 0x7162, 0x7162, 0x7162,
+         0x7162, 0x5510, 0x3660, 0x3a57, 0x3a57, 0x3956, 0x385f, 0x35c4,
+         0x3548, 0x34d0, 0x34ce, 0x3456, 0x4ed4, 0x6c15, 0x6d9a, 0x6db0,
+         0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9, 0x6f47, 0x8c15,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x71df, 0x71df, 0x71df, 0x71df, 0x71df, 0x71df, 0x71df, 0x71df,
+         0x71e2, 0x5510, 0x3ada, 0x3a57, 0x3a57, 0x3956, 0x385f, 0x3642,
+         0x35c6, 0x354a, 0x34ce, 0x3456, 0x4ed4, 0x6c15, 0x6d9a, 0x6db0,
+         0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9, 0x6f47, 0x8c15,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x725e, 0x725e, 0x725e, 0x725e, 0x725e, 0x725e, 0x725e, 0x725e,
+         0x733e, 0x5510, 0x3ada, 0x3a57, 0x3a57, 0x3956, 0x385f, 0x364b,
+         0x35cf, 0x3554, 0x34dc, 0x34da, 0x4ed4, 0x6c15, 0x6d9a, 0x6db0,
+         0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9, 0x6f47, 0x8c15,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x72de, 0x72de, 0x72de, 0x72de, 0x72de, 0x72e2, 0x72e2, 0x6663,
+         0x6663, 0x4064, 0x3ada, 0x3a57, 0x3a57, 0x3956, 0x385f, 0x364b,
+         0x35cf, 0x3560, 0x3556, 0x34da, 0x4ed4, 0x69e1, 0x6d9a, 0x6db0,
+         0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9, 0x6f47, 0x89e1,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x7360, 0x7360, 0x7360, 0x7360, 0x6563, 0x6563, 0x65de, 0x665b,
+         0x665a, 0x5510, 0x51c2, 0x3a5e, 0x3a5e, 0x3956, 0x385f, 0x3658,
+         0x325e, 0x3560, 0x355f, 0x4014, 0x4ed4, 0x69d6, 0x6a5a, 0x6ae2,
+         0x6ae3, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9, 0x6f47, 0x89d6,
+         0x8a5a, 0x8ae2, 0x8ae3, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x735f, 0x735f, 0x735f, 0x64df, 0x655e, 0x655e, 0x6557, 0x65d2,
+         0x65d2, 0x5621, 0x51c2, 0x3a5e, 0x3a5e, 0x3956, 0x375c, 0x3656,
+         0x3656, 0x335f, 0x355f, 0x4014, 0x4ed4, 0x69cc, 0x6a4f, 0x6ad6,
+         0x6ae3, 0x6b64, 0x6b63, 0x6e41, 0x6ebf, 0x6ec9, 0x6f47, 0x89cc,
+         0x8a4f, 0x8ad6, 0x8ae3, 0x8b64, 0x8b63, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x73e1, 0x645f, 0x645f, 0x645e, 0x64d3, 0x64d3, 0x654e, 0x64d3,
+         0x65d1, 0x562c, 0x51c2, 0x5162, 0x5162, 0x395f, 0x375c, 0x3660,
+         0x3660, 0x403e, 0x403c, 0x4032, 0x4d56, 0x69c9, 0x6a4e, 0x6ad2,
+         0x6ae3, 0x6b64, 0x6b63, 0x6c59, 0x6c5a, 0x6ce1, 0x6cde, 0x89c9,
+         0x8a4e, 0x8ad2, 0x8ae3, 0x8b64, 0x8b63, 0x8c59, 0x8c5a, 0x8ce1},
+        {0x635c, 0x6357, 0x6357, 0x6358, 0x63cc, 0x6443, 0x6440, 0x63e2,
+         0x64b9, 0x562c, 0x51c2, 0x42d5, 0x4357, 0x395f, 0x37db, 0x3660,
+         0x3660, 0x403e, 0x403c, 0x4032, 0x51e2, 0x69c9, 0x6a4e, 0x6ad2,
+         0x6ae3, 0x6b64, 0x6b63, 0x6c59, 0x6c5a, 0x6cdd, 0x6cde, 0x89c9,
+         0x8a4e, 0x8ad2, 0x8ae3, 0x8b64, 0x8b63, 0x8c59, 0x8c5a, 0x8cdd},
+        {0x605c, 0x6254, 0x4064, 0x6064, 0x6048, 0x603e, 0x4052, 0x6052,
+         0x62d6, 0x41e0, 0x41e0, 0x41d4, 0x41e2, 0x395f, 0x37db, 0x3662,
+         0x3662, 0x403e, 0x403c, 0x4032, 0x4e61, 0x69c9, 0x6a4e, 0x6ad2,
+         0x6b52, 0x6b64, 0x6bd6, 0x6c59, 0x6c5a, 0x6cdd, 0x6cde, 0x89c9,
+         0x8a4e, 0x8ad2, 0x8b52, 0x8b64, 0x8bd6, 0x8c59, 0x8c5a, 0x8cdd},
+        {0x6046, 0x6048, 0x4064, 0x603c, 0x6032, 0x602a, 0x4052, 0x601e,
+         0x4050, 0x56c0, 0x405c, 0x4048, 0x4034, 0x403c, 0x402a, 0x4eb5,
+         0x4f3d, 0x4eb5, 0x4f48, 0x4f5c, 0x5160, 0x6c15, 0x6d9a, 0x6db0,
+         0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9, 0x6f47, 0x8c15,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x7164, 0x7164, 0x7162, 0x7164, 0x7162, 0x5e5f, 0x5de3, 0x5d48,
+         0x5bcf, 0x5a57, 0x5560, 0x5360, 0x5352, 0x52de, 0x525e, 0x525d,
+         0x51df, 0x51df, 0x51e2, 0x51ce, 0x51e4, 0x6c15, 0x6d9a, 0x6db0,
+         0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9, 0x6f47, 0x8c15,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x7162, 0x7162, 0x7162, 0x7162, 0x7162, 0x5cd8, 0x5cce, 0x5bdd,
+         0x5b5b, 0x575c, 0x5660, 0x5554, 0x5463, 0x455c, 0x535f, 0x52e2,
+         0x52e2, 0x525e, 0x52e0, 0x52d7, 0x525d, 0x6c15, 0x6d9a, 0x6db0,
+         0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9, 0x6f47, 0x8c15,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x7162, 0x7162, 0x7162, 0x7162, 0x5ce4, 0x5c61, 0x41e2, 0x41e2,
+         0x41e2, 0x575c, 0x4259, 0x4259, 0x54da, 0x5456, 0x45d2, 0x4a4f,
+         0x53e2, 0x4d61, 0x4ddc, 0x53c4, 0x52de, 0x6c15, 0x6d9a, 0x6db0,
+         0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9, 0x6f47, 0x8c15,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x7162, 0x6064, 0x615d, 0x605c, 0x6064, 0x5c61, 0x40db, 0x40db,
+         0x40db, 0x57d2, 0x4154, 0x414a, 0x414a, 0x40d2, 0x545a, 0x53e2,
+         0x4e62, 0x5449, 0x53d4, 0x5449, 0x6ed4, 0x72a5, 0x72a6, 0x7230,
+         0x7230, 0x723c, 0x71c4, 0x71c2, 0x71c2, 0x71cd, 0x71ce, 0x89e2,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x7162, 0x7162, 0x6663, 0x5c62, 0x5c62, 0x5bde, 0x5b62, 0x5ad9,
+         0x5a57, 0x575c, 0x5660, 0x55da, 0x555f, 0x5554, 0x5464, 0x5463,
+         0x525e, 0x51e0, 0x544a, 0x53d2, 0x675e, 0x69e2, 0x73a7, 0x732e,
+         0x72ba, 0x7345, 0x72bf, 0x7247, 0x7247, 0x72d8, 0x7252, 0x89d6,
+         0x8a5a, 0x8ae2, 0x8ae3, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x64df, 0x64df, 0x64df, 0x64df, 0x64df, 0x5bde, 0x5ada, 0x5ada,
+         0x5a57, 0x5956, 0x57db, 0x564b, 0x55cf, 0x555f, 0x5548, 0x5463,
+         0x54c3, 0x535f, 0x52d7, 0x5456, 0x675c, 0x69e1, 0x742f, 0x73b6,
+         0x733e, 0x7350, 0x7346, 0x72cb, 0x72cb, 0x72e0, 0x72d7, 0x89ce,
+         0x8a4f, 0x8ad6, 0x8ae3, 0x8e38, 0x8b63, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x64df, 0x64df, 0x64df, 0x64df, 0x64df, 0x5bde, 0x5bde, 0x5b5b,
+         0x5a5e, 0x595f, 0x57db, 0x5660, 0x55dc, 0x5560, 0x555f, 0x554a,
+         0x54ce, 0x5456, 0x5456, 0x545a, 0x6752, 0x69d6, 0x6a5a, 0x6ae2,
+         0x6ae3, 0x7350, 0x734f, 0x7352, 0x72e0, 0x72e0, 0x72de, 0x89c9,
+         0x8a4e, 0x8ad2, 0x8ae3, 0x8b64, 0x8b63, 0x8c59, 0x8c63, 0x8ce1},
+        {0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x5b62,
+         0x59e3, 0x575c, 0x5660, 0x5660, 0x5656, 0x55da, 0x555f, 0x5554,
+         0x5554, 0x5556, 0x5464, 0x53db, 0x66d4, 0x69d6, 0x6a5a, 0x6ae2,
+         0x6ae3, 0x73d4, 0x73d2, 0x73db, 0x7360, 0x7360, 0x735f, 0x89c9,
+         0x8a4e, 0x8ad2, 0x8ae3, 0x8b64, 0x8b63, 0x8c59, 0x8c5a, 0x8cdd},
+        {0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x5b62,
+         0x59e3, 0x595f, 0x575b, 0x5662, 0x5660, 0x564b, 0x55cf, 0x5560,
+         0x5556, 0x5556, 0x54da, 0x5463, 0x66d4, 0x69d6, 0x6a5a, 0x6ae2,
+         0x6ae3, 0x7458, 0x73d2, 0x73db, 0x73db, 0x8014, 0x735f, 0x89c9,
+         0x8a4e, 0x8ad2, 0x8ae3, 0x8b64, 0x8b63, 0x8c59, 0x8c5a, 0x8cdd},
+    },
+    {
+        {0x615e, 0x615e, 0x6153, 0x6153, 0x6153, 0x6152, 0x6152, 0x6152,
+         0x6152, 0x6152, 0x6152, 0x6152, 0x6152, 0x4064, 0x4064, 0x405a,
+         0x405a, 0x4052, 0x4052, 0x4050, 0x4046, 0x4046, 0x403e, 0x403c,
+         0x4032, 0x402a, 0x4028, 0x401e, 0x4014, 0x4006, 0x2663, 0x2664,
+         0x26e0, 0x28db, 0x29e2, 0x405a, 0x4052, 0x4050, 0x4046, 0x4046},
+        {0x605a, 0x605a, 0x6052, 0x6052, 0x6050, 0x6046, 0x6046, 0x603e,
+         0x603c, 0x6032, 0x602a, 0x4064, 0x4064, 0x405a, 0x405a, 0x5de3,
+         0x5de3, 0x5dda, 0x5dda, 0x5dd8, 0x5d52, 0x5d52, 0x5d47, 0x5d47,
+         0x5cc2, 0x5c3a, 0x5c3a, 0x5c2d, 0x2563, 0x25de, 0x265b, 0x265a,
+         0x26d6, 0x28d2, 0x29d6, 0x2ae2, 0x2ae2, 0x2ae3, 0x402a, 0x4028},
+        {0x7e5f, 0x7de4, 0x7de4, 0x7de4, 0x7ce4, 0x7cda, 0x7cd9, 0x7c56,
+         0x7c54, 0x7bcf, 0x7bc2, 0x4064, 0x4064, 0x5e5f, 0x5de4, 0x5de3,
+         0x5de3, 0x5ce4, 0x5cda, 0x5cd9, 0x5c56, 0x5c54, 0x5bcf, 0x5bc2,
+         0x5bc2, 0x5b3b, 0x5ab5, 0x5933, 0x2563, 0x2564, 0x25dd, 0x2658,
+         0x2658, 0x28d2, 0x29d6, 0x2ae0, 0x2ae2, 0x2ae3, 0x402a, 0x4028},
+        {0x7de3, 0x7de3, 0x7dd8, 0x7c62, 0x7c62, 0x7bde, 0x7bde, 0x7b5b,
+         0x7b4b, 0x4064, 0x7ac7, 0x405a, 0x405c, 0x5de3, 0x5de3, 0x5dda,
+         0x5dda, 0x5d5d, 0x5c62, 0x5c61, 0x5bde, 0x5bdd, 0x5b5b, 0x5b4b,
+         0x5b4b, 0x5ac7, 0x24df, 0x4c15, 0x255e, 0x2557, 0x25d2, 0x264e,
+         0x2658, 0x28c7, 0x29ce, 0x2ad6, 0x2a5a, 0x2ae3, 0x2b63, 0x4016},
+        {0x7dda, 0x7dda, 0x7d5d, 0x7d52, 0x7cd8, 0x7bde, 0x7bde, 0x7b5b,
+         0x7ada, 0x4064, 0x4064, 0x5e5f, 0x5de4, 0x5de3, 0x5de3, 0x5d5e,
+         0x5d5e, 0x5d54, 0x5c62, 0x5c61, 0x5b62, 0x5ada, 0x5b5b, 0x5a57,
+         0x4663, 0x46df, 0x24df, 0x24e0, 0x255c, 0x2557, 0x24df, 0x25d1,
+         0x264d, 0x28c7, 0x29ce, 0x2ad5, 0x2ad6, 0x2b5e, 0x2b63, 0x4016},
+        {0x7d5e, 0x7d5e, 0x7d54, 0x7d52, 0x7cd8, 0x7bde, 0x6563, 0x7b5b,
+         0x6563, 0x6563, 0x4064, 0x5de3, 0x5de4, 0x5dda, 0x5de3, 0x5d5d,
+         0x5d52, 0x5cd8, 0x5cda, 0x5ccc, 0x5bde, 0x4563, 0x4563, 0x4563,
+         0x4563, 0x4563, 0x4563, 0x24df, 0x245f, 0x245f, 0x245e, 0x24df,
+         0x2563, 0x28be, 0x29ca, 0x2ad2, 0x2ad2, 0x2b64, 0x402a, 0x4028},
+        {0x7d5d, 0x7d52, 0x7cd8, 0x7cd8, 0x7ccc, 0x64df, 0x64df, 0x655e,
+         0x64df, 0x64df, 0x64df, 0x5de3, 0x5de3, 0x5d5e, 0x5dda, 0x5d5d,
+         0x5d52, 0x5cd8, 0x5cce, 0x5c61, 0x5bde, 0x44df, 0x44df, 0x44df,
+         0x44df, 0x4357, 0x44df, 0x44df, 0x245f, 0x245f, 0x245e, 0x245c,
+         0x245e, 0x2563, 0x29ca, 0x2a5c, 0x2b52, 0x4046, 0x403e, 0x403c},
+        {0x7d5d, 0x7d52, 0x7cd8, 0x645f, 0x645f, 0x645e, 0x645e, 0x64df,
+         0x645e, 0x645e, 0x4064, 0x4064, 0x5de3, 0x5d5e, 0x5d5e, 0x5ce4,
+         0x5cda, 0x5cd9, 0x5c56, 0x5c54, 0x445f, 0x445f, 0x425a, 0x445e,
+         0x445e, 0x445e, 0x445e, 0x23e2, 0x23da, 0x23da, 0x23da, 0x23da,
+         0x245c, 0x24d3, 0x2752, 0x2a5a, 0x4046, 0x2ce2, 0x402a, 0x4028},
+        {0x7ce4, 0x7cda, 0x635a, 0x635a, 0x6357, 0x6357, 0x6357, 0x6357,
+         0x634e, 0x6357, 0x6357, 0x4064, 0x5e5f, 0x5de3, 0x5d5e, 0x5ce4,
+         0x5cda, 0x5c61, 0x435a, 0x4357, 0x4357, 0x4357, 0x4357, 0x4357,
+         0x4357, 0x4357, 0x41e2, 0x41d6, 0x234e, 0x23d9, 0x23d9, 0x23d9,
+         0x23d9, 0x244e, 0x27db, 0x2b43, 0x2d4e, 0x4046, 0x403e, 0x403c},
+        {0x625a, 0x6259, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253,
+         0x6052, 0x6253, 0x6253, 0x6253, 0x5de3, 0x5de3, 0x4264, 0x425a,
+         0x425a, 0x4259, 0x405a, 0x4253, 0x4253, 0x4253, 0x4253, 0x4253,
+         0x4253, 0x4253, 0x4253, 0x4254, 0x4052, 0x235a, 0x2357, 0x2357,
+         0x2357, 0x23ca, 0x2442, 0x2cde, 0x4046, 0x4046, 0x4046, 0x403e},
+        {0x9660, 0x9660, 0x9660, 0x9660, 0x9660, 0x9660, 0x9660, 0x7b62,
+         0x7a5e, 0x7942, 0x733e, 0x79e3, 0x78de, 0x76dd, 0x7660, 0x7660,
+         0x75dc, 0x7560, 0x755f, 0x4046, 0x4048, 0x403e, 0x403c, 0x4032,
+         0x5b62, 0x5a5e, 0x59d9, 0x58da, 0x56d3, 0x22d6, 0x22d6, 0x22d6,
+         0x2346, 0x22de, 0x2346, 0x2d56, 0x4046, 0x4046, 0x4048, 0x403e},
+        {0x9d54, 0x9d47, 0x9d47, 0x9cc2, 0x9c3a, 0x9c3a, 0x9c2d, 0x9b2c,
+         0x7b5c, 0x6046, 0x6048, 0x73e1, 0x603c, 0x6032, 0x602a, 0x6028,
+         0x601e, 0x6014, 0x7b5c, 0x5d52, 0x5d54, 0x5d47, 0x5d47, 0x5cc2,
+         0x5c3a, 0x5c3a, 0x5c2d, 0x5b2c, 0x59a2, 0x2253, 0x2253, 0x2253,
+         0x22c2, 0x225a, 0x22c2, 0x2cde, 0x4046, 0x4046, 0x4048, 0x403e},
+        {0x9164, 0x9164, 0x9162, 0x9c3e, 0x9bc4, 0x9b3c, 0x9ab5, 0x7b5b,
+         0x8028, 0x7d5a, 0x7cd9, 0x7cce, 0x73e2, 0x7c47, 0x7c3e, 0x7bc4,
+         0x7b3c, 0x7ab5, 0x79a3, 0x5d52, 0x5cd8, 0x5cce, 0x5c54, 0x5c47,
+         0x5c3a, 0x5bc1, 0x5b3c, 0x5ab5, 0x59a2, 0x21d2, 0x21d2, 0x21d2,
+         0x21d2, 0x21d2, 0x223a, 0x2cde, 0x4046, 0x2c63, 0x2c5a, 0x4016},
+        {0x9162, 0x9162, 0x9164, 0x9162, 0x9ac7, 0x9a42, 0x9936, 0x9414,
+         0x92a5, 0x7c62, 0x7c61, 0x7bde, 0x7bdd, 0x7b5b, 0x7b4b, 0x7b4b,
+         0x7ac7, 0x7a42, 0x7933, 0x5c62, 0x5c61, 0x5bde, 0x5bdd, 0x5b5b,
+         0x5b4b, 0x5b4b, 0x5ac7, 0x5a42, 0x5933, 0x2046, 0x2016, 0x200a,
+         0x2002, 0x201e, 0x201e, 0x2d56, 0x2b64, 0x2cd1, 0x2d62, 0x4016},
+        {0x91df, 0x91df, 0x9b56, 0x91e2, 0x9a58, 0x99d8, 0x9942, 0x8663,
+         0x8663, 0x7c62, 0x7c61, 0x7bde, 0x7bdd, 0x7b5b, 0x7ada, 0x7ad9,
+         0x7a57, 0x6663, 0x6663, 0x5c62, 0x5c61, 0x5bde, 0x5bdd, 0x5b5b,
+         0x5ada, 0x5ad9, 0x5a57, 0x4663, 0x4663, 0x2046, 0x2016, 0x200a,
+         0x2002, 0x201e, 0x201e, 0x2a50, 0x4046, 0x4046, 0x2e64, 0x4016},
+        {0x925e, 0x925e, 0x9ada, 0x9ad9, 0x8563, 0x8563, 0x85de, 0x865b,
+         0x865a, 0x7c62, 0x7cd8, 0x7bde, 0x7bde, 0x7b5b, 0x6563, 0x6563,
+         0x65de, 0x665b, 0x665a, 0x5c62, 0x5c61, 0x5bde, 0x5bdd, 0x5b5b,
+         0x4563, 0x4563, 0x45de, 0x465b, 0x465a, 0x3cda, 0x2663, 0x2664,
+         0x26e0, 0x28db, 0x29e2, 0x3162, 0x2f3d, 0x2fbe, 0x2f48, 0x2f5c},
+        {0x92e2, 0x92e2, 0x9ada, 0x84df, 0x855e, 0x855e, 0x8557, 0x85d2,
+         0x85d2, 0x7cda, 0x7c61, 0x7bde, 0x7bdd, 0x64df, 0x655e, 0x655e,
+         0x6557, 0x65d2, 0x65d2, 0x5c62, 0x5c61, 0x5bde, 0x5bdd, 0x44df,
+         0x455e, 0x455e, 0x4557, 0x45d2, 0x45d2, 0x3c62, 0x265b, 0x265a,
+         0x26d6, 0x28d2, 0x29d6, 0x2ae2, 0x2ae2, 0x2ae3, 0x402a, 0x4028},
+        {0x9bdd, 0x845f, 0x845f, 0x845e, 0x84d3, 0x84d3, 0x854e, 0x8558,
+         0x85c6, 0x7c62, 0x7c61, 0x645f, 0x645f, 0x645e, 0x64d3, 0x64d3,
+         0x654e, 0x6558, 0x65c6, 0x5c62, 0x5c61, 0x445f, 0x445f, 0x445e,
+         0x44d3, 0x44d3, 0x454e, 0x4558, 0x45c6, 0x3ce4, 0x25dd, 0x2658,
+         0x2658, 0x28d2, 0x29d6, 0x2ae0, 0x2ae2, 0x2ae3, 0x325e, 0x4016},
+        {0x835c, 0x8357, 0x8357, 0x8358, 0x83cc, 0x8443, 0x8440, 0x8440,
+         0x84b9, 0x635a, 0x635c, 0x6357, 0x6357, 0x6358, 0x63cc, 0x6443,
+         0x6440, 0x6440, 0x64b9, 0x435a, 0x435c, 0x4357, 0x4357, 0x4358,
+         0x43cc, 0x4443, 0x4440, 0x4440, 0x44b9, 0x4534, 0x25d2, 0x264e,
+         0x2658, 0x28c7, 0x2764, 0x29e1, 0x2ad6, 0x2ae3, 0x2b63, 0x32de},
+        {0x8254, 0x8254, 0x82c8, 0x82c2, 0x82c0, 0x8335, 0x8333, 0x8334,
+         0x83ab, 0x6253, 0x6254, 0x6254, 0x62c8, 0x62c2, 0x62c0, 0x6335,
+         0x6333, 0x6334, 0x63ab, 0x42d6, 0x435c, 0x434e, 0x434e, 0x4346,
+         0x43bb, 0x43bb, 0x43ba, 0x4432, 0x4432, 0x4253, 0x33d2, 0x33d2,
+         0x33d4, 0x335f, 0x335f, 0x335f, 0x3449, 0x335f, 0x33d2, 0x335f},
+        {0xb463, 0x9b62, 0x9ada, 0x9b62, 0x9a5e, 0x99da, 0x98da, 0x96d3,
+         0x9656, 0x95da, 0x9463, 0x9463, 0x9463, 0x7b62, 0x7ada, 0x7ada,
+         0x7a5e, 0x79d9, 0x78da, 0x76d3, 0x755f, 0x755f, 0x755f, 0x5b62,
+         0x5ada, 0x5ada, 0x5a57, 0x59d6, 0x58da, 0x564b, 0x3463, 0x3463,
+         0x36ca, 0x35cf, 0x3560, 0x3556, 0x34da, 0x3463, 0x402a, 0x4028},
+        {0xb162, 0xb162, 0xb162, 0xb162, 0xb162, 0xb162, 0xb162, 0xb162,
+         0xb162, 0x9d52, 0x9cc2, 0x9162, 0x9162, 0x9162, 0x9162, 0x9162,
+         0x9414, 0x92a5, 0x92a5, 0x7d52, 0x71c2, 0x7162, 0x7162, 0x7162,
+         0x7162, 0x7162, 0x7162, 0x7162, 0x7162, 0x5510, 0x51c2, 0x5162,
+         0x5164, 0x5162, 0x5162, 0x5162, 0x5162, 0x5162, 0x5162, 0x5162},
+        {0xb1df, 0xb1df, 0xb1df, 0xb1df, 0xb1df, 0xb1df, 0xb1df, 0xb1df,
+         0xb1e2, 0x9d52, 0x9cc2, 0x91df, 0x91df, 0x91e2, 0x91e2, 0x91e2,
+         0x949e, 0x9422, 0x93a7, 0x7d52, 0x7247, 0x71df, 0x71df, 0x71df,
+         0x71df, 0x71df, 0x71df, 0x71df, 0x71e2, 0x5621, 0x5247, 0x51df,
+         0x51df, 0x51df, 0x51df, 0x51df, 0x51df, 0x51df, 0x51df, 0x51df},
+        {0xb25e, 0xb25e, 0xb25e, 0xb25e, 0xb25e, 0xb25e, 0xb25e, 0xb25e,
+         0xb33e, 0x9c62, 0x9c47, 0x925e, 0x925e, 0x9b3c, 0x9ab5, 0x99a3,
+         0x9526, 0x94aa, 0x942f, 0x7c62, 0x72cb, 0x725e, 0x725e, 0x725e,
+         0x725e, 0x725e, 0x725e, 0x725e, 0x733e, 0x562c, 0x52cb, 0x525e,
+         0x525e, 0x525e, 0x525e, 0x525e, 0x525e, 0x525e, 0x525e, 0x525e},
+        {0xb2de, 0xb2de, 0xb2de, 0xb2de, 0xb2de, 0xb2e2, 0xb2e2, 0xb2e2,
+         0xb350, 0x9c62, 0x9bcf, 0x92e2, 0x92e2, 0x9b3b, 0x9ab5, 0x9933,
+         0x95ae, 0x94b8, 0x943c, 0x7c62, 0x72e0, 0x72de, 0x72de, 0x72de,
+         0x72de, 0x72e2, 0x72e2, 0x72e2, 0x7350, 0x562c, 0x52e0, 0x52de,
+         0x52de, 0x52de, 0x52de, 0x52de, 0x52de, 0x52de, 0x52de, 0x52de},
+        {0xb360, 0xb360, 0xb360, 0xb360, 0xb53d, 0xb4c4, 0xb4c4, 0xa663,
+         0xa663, 0x9c62, 0x9bdd, 0x9bd0, 0x9b4c, 0x9ac8, 0x9a44, 0x99bc,
+         0x9638, 0x8663, 0x8663, 0x7c62, 0x7360, 0x7360, 0x7360, 0x7360,
+         0x753d, 0x74c4, 0x74c4, 0x6663, 0x6663, 0x56b4, 0x5360, 0x5360,
+         0x5360, 0x5360, 0x5360, 0x5360, 0x5360, 0x5360, 0x5360, 0x5360},
+        {0xb35f, 0xb35f, 0xb35f, 0xa4df, 0xa55e, 0xa55e, 0xa557, 0xa5d2,
+         0xa5d2, 0x9c62, 0x9bd2, 0x9b4b, 0x9b4b, 0x84df, 0x855e, 0x855e,
+         0x8557, 0x85d2, 0x85d2, 0x7c62, 0x73d2, 0x735f, 0x735f, 0x64df,
+         0x655e, 0x655e, 0x6557, 0x65d2, 0x65d2, 0x56c0, 0x53d2, 0x535f,
+         0x535f, 0x535f, 0x535f, 0x535f, 0x535f, 0x535f, 0x535f, 0x535f},
+        {0xb3e1, 0xb3e1, 0xb3e2, 0xa4df, 0xa4e0, 0xa55c, 0xa557, 0xa558,
+         0xa5d1, 0x9c62, 0x9b5b, 0x9b56, 0x9b54, 0x84df, 0x84e0, 0x855c,
+         0x8557, 0x8558, 0x85d1, 0x7c62, 0x73e1, 0x73e1, 0x73e2, 0x64df,
+         0x64e0, 0x655c, 0x6557, 0x6558, 0x65d1, 0x56c0, 0x53e1, 0x53e1,
+         0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1},
+        {0xb3e2, 0xa357, 0xa357, 0xa3ca, 0xa443, 0xa443, 0xa442, 0xa4ba,
+         0xa4ba, 0x835a, 0x9b5b, 0x8357, 0x8357, 0x83ca, 0x8443, 0x8443,
+         0x8442, 0x84ba, 0x84ba, 0x635a, 0x73e2, 0x6357, 0x6357, 0x63ca,
+         0x6443, 0x6443, 0x6442, 0x64ba, 0x64ba, 0x56c9, 0x53e2, 0x53e2,
+         0x53e2, 0x53e2, 0x53e2, 0x53e2, 0x53e2, 0x53e2, 0x53e2, 0x53e2},
+        {0xa2d5, 0xa2ca, 0xa2ca, 0xa2c2, 0xa336, 0xa336, 0xa333, 0xa3ab,
+         0xa3ab, 0x8253, 0x82d5, 0x82ca, 0x82ca, 0x82c2, 0x8336, 0x8336,
+         0x8333, 0x83ab, 0x83ab, 0x6253, 0x62d5, 0x62ca, 0x62ca, 0x62c2,
+         0x6336, 0x6336, 0x6333, 0x63ab, 0x63ab, 0x56c9, 0x5464, 0x5464,
+         0x5464, 0x5464, 0x5464, 0x5464, 0x5464, 0x5464, 0x5464, 0x5464},
+    },
+    {
+        {0x43e4, 0x4357, 0x4357, 0x43ca, 0x4443, 0x4443, 0x4442, 0x44ba,
+         0x44ba, 0x4046, 0x403c, 0x4032, 0x402a, 0x4028, 0x401e, 0x4014,
+         0x4006, 0x23e2, 0x23da, 0x23d9, 0x23d9, 0x23da, 0x244e, 0x24c6,
+         0x24c8, 0x23e2, 0x23e2, 0x23da, 0x23d9, 0x23d9, 0x4ed4, 0x49c9,
+         0x4a4e, 0x4ad2, 0x4ae3, 0x4bd8, 0x4b63, 0x4c59, 0x4c5a, 0x4cdd},
+        {0x435c, 0x435c, 0x4358, 0x4358, 0x43cc, 0x4444, 0x4440, 0x4440,
+         0x44b9, 0x5d52, 0x5d47, 0x5162, 0x5162, 0x5162, 0x5c2d, 0x5b2c,
+         0x235a, 0x235a, 0x2357, 0x2357, 0x2357, 0x2357, 0x23d9, 0x2440,
+         0x2440, 0x235a, 0x235a, 0x2357, 0x2357, 0x2357, 0x4ed4, 0x49c9,
+         0x4a4f, 0x4ad6, 0x4ae3, 0x4bd8, 0x4b63, 0x4c59, 0x4c5a, 0x4cdd},
+        {0x42d5, 0x42d5, 0x434d, 0x4346, 0x4345, 0x43bb, 0x43ba, 0x4432,
+         0x4432, 0x5cda, 0x5bcf, 0x5162, 0x5162, 0x22de, 0x22de, 0x22de,
+         0x22d6, 0x22d6, 0x22d6, 0x22d6, 0x22d6, 0x2346, 0x22de, 0x22de,
+         0x22de, 0x22d6, 0x22d6, 0x22d6, 0x22d6, 0x2346, 0x2ce2, 0x4c15,
+         0x4d9a, 0x4db0, 0x4db0, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9},
+        {0x4254, 0x4254, 0x42c8, 0x42c2, 0x42c0, 0x4335, 0x4333, 0x4334,
+         0x43ab, 0x5c62, 0x51c2, 0x5162, 0x5162, 0x225a, 0x225a, 0x225a,
+         0x2253, 0x2253, 0x2253, 0x2253, 0x2253, 0x2253, 0x225a, 0x225a,
+         0x225a, 0x2253, 0x2253, 0x2253, 0x2253, 0x22c2, 0x2cde, 0x4c15,
+         0x4d9a, 0x4db0, 0x4db0, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9},
+        {0x41d4, 0x41c2, 0x41c2, 0x41b6, 0x41b2, 0x41b2, 0x4223, 0x4222,
+         0x4222, 0x5c62, 0x51c2, 0x21e2, 0x21e0, 0x21d6, 0x21d5, 0x21d5,
+         0x21d2, 0x21d2, 0x21d2, 0x21d2, 0x21d2, 0x21d2, 0x21d2, 0x21d2,
+         0x21d2, 0x21d2, 0x21d2, 0x21d2, 0x21d2, 0x21d4, 0x2dd2, 0x49e1,
+         0x4d9a, 0x4db0, 0x4db0, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9},
+        {0x4048, 0x403e, 0x403c, 0x4032, 0x402a, 0x4028, 0x401e, 0x4014,
+         0x4006, 0x2064, 0x2064, 0x205a, 0x205a, 0x2052, 0x2050, 0x2050,
+         0x2046, 0x2046, 0x203e, 0x203c, 0x2032, 0x202a, 0x2028, 0x201e,
+         0x2014, 0x2002, 0x2002, 0x203e, 0x203c, 0x2032, 0x2e57, 0x49d6,
+         0x4a5a, 0x4ae2, 0x4ae3, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9},
+        {0x5d54, 0x5d54, 0x5d48, 0x44df, 0x455e, 0x455e, 0x4557, 0x45d2,
+         0x45d2, 0x464e, 0x51c2, 0x3e5f, 0x3e5f, 0x3e56, 0x3e55, 0x3e55,
+         0x3dce, 0x3dce, 0x3dc3, 0x3dc3, 0x24df, 0x24df, 0x255e, 0x2557,
+         0x25d2, 0x264e, 0x26ca, 0x294a, 0x2a4f, 0x24df, 0x30ca, 0x49cc,
+         0x4a4f, 0x4ad6, 0x4ae3, 0x4b64, 0x4b63, 0x4e41, 0x4ebf, 0x4ec9},
+        {0x5cd8, 0x5cd8, 0x5ccc, 0x5cc2, 0x44e0, 0x455c, 0x4558, 0x44d3,
+         0x45d1, 0x464d, 0x51c2, 0x3de3, 0x3de3, 0x3dda, 0x3dd8, 0x3dd8,
+         0x3d52, 0x3d52, 0x3d47, 0x3d47, 0x24df, 0x24df, 0x24e0, 0x2557,
+         0x2558, 0x25d1, 0x26ca, 0x294a, 0x2a4f, 0x24df, 0x31df, 0x49c9,
+         0x4a4e, 0x4ad2, 0x4ae3, 0x4b64, 0x4b63, 0x4c59, 0x4c5a, 0x4ce1},
+        {0x6357, 0x445f, 0x445f, 0x445e, 0x44d3, 0x44d3, 0x454e, 0x45c6,
+         0x45c6, 0x4642, 0x41e2, 0x41e2, 0x41d6, 0x3d5e, 0x3d5d, 0x3d5d,
+         0x3d5a, 0x3cd8, 0x3cce, 0x245f, 0x245e, 0x245e, 0x24d3, 0x254e,
+         0x2558, 0x25d1, 0x26c2, 0x245f, 0x245f, 0x245e, 0x32de, 0x49c9,
+         0x4a4e, 0x4ad2, 0x4ae3, 0x4b64, 0x4b63, 0x4c59, 0x4c5a, 0x4cdd},
+        {0x5cd9, 0x445f, 0x445f, 0x4064, 0x44d3, 0x44d3, 0x454e, 0x4052,
+         0x42d6, 0x4064, 0x4050, 0x4052, 0x4052, 0x3d5e, 0x3ce4, 0x3ce4,
+         0x3ce4, 0x3cd9, 0x20db, 0x3c54, 0x245c, 0x245c, 0x24d3, 0x254c,
+         0x254c, 0x25c8, 0x26c0, 0x245f, 0x245f, 0x245e, 0x451c, 0x49c9,
+         0x4a4e, 0x4ad2, 0x4b52, 0x4b64, 0x4bd6, 0x4c59, 0x4c5a, 0x4cdd},
+        {0x4064, 0x405a, 0x405a, 0x4064, 0x4052, 0x4064, 0x4046, 0x4052,
+         0x405a, 0x5c62, 0x53d2, 0x52cc, 0x51c2, 0x5162, 0x5162, 0x5162,
+         0x3cda, 0x3c61, 0x4028, 0x401e, 0x525e, 0x54da, 0x3b62, 0x3a57,
+         0x39d6, 0x38d8, 0x364b, 0x3560, 0x3556, 0x3463, 0x4ee0, 0x5660,
+         0x6c15, 0x6d9a, 0x6db0, 0x6db0, 0x6064, 0x605a, 0x605c, 0x605c},
+        {0x7162, 0x5de3, 0x5de3, 0x5dda, 0x5dda, 0x5dd8, 0x5dce, 0x5d48,
+         0x5bcf, 0x5a57, 0x554a, 0x5360, 0x534f, 0x52de, 0x525e, 0x525d,
+         0x3c62, 0x403e, 0x403c, 0x4032, 0x51c2, 0x5162, 0x5162, 0x5162,
+         0x5162, 0x5162, 0x5162, 0x5162, 0x5162, 0x5162, 0x5162, 0x6c15,
+         0x6d9a, 0x6db0, 0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x7162, 0x5de3, 0x5de3, 0x5d5e, 0x5dda, 0x5cd8, 0x5cce, 0x5bdd,
+         0x5b5b, 0x56c0, 0x5548, 0x54d0, 0x53e1, 0x53d2, 0x535f, 0x52e2,
+         0x52e2, 0x525e, 0x52a6, 0x52a7, 0x5247, 0x51df, 0x51df, 0x51df,
+         0x51df, 0x51df, 0x51df, 0x51df, 0x51df, 0x51df, 0x51df, 0x6c15,
+         0x6d9a, 0x6db0, 0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x7162, 0x5de3, 0x6c15, 0x5d5e, 0x5ce4, 0x5c61, 0x5c54, 0x5b5c,
+         0x5ac7, 0x573e, 0x55c6, 0x54ce, 0x5456, 0x53e2, 0x53d2, 0x535f,
+         0x535f, 0x535f, 0x5350, 0x532e, 0x52cb, 0x525e, 0x525e, 0x525e,
+         0x525e, 0x525e, 0x525e, 0x525e, 0x525e, 0x525e, 0x525e, 0x6c15,
+         0x6d9a, 0x6db0, 0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x66df, 0x6663, 0x6663, 0x5d5e, 0x6663, 0x5c61, 0x5bdd, 0x5b56,
+         0x5a57, 0x56c9, 0x564c, 0x5554, 0x54da, 0x5463, 0x5458, 0x53e1,
+         0x53e2, 0x5449, 0x53d4, 0x53b6, 0x52e0, 0x52de, 0x52de, 0x52de,
+         0x52de, 0x52de, 0x52de, 0x52de, 0x52e2, 0x52e2, 0x52e2, 0x69e1,
+         0x6d9a, 0x6db0, 0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x6563, 0x6563, 0x6563, 0x5c62, 0x5c62, 0x5bde, 0x5b5b, 0x5ad9,
+         0x5a57, 0x575c, 0x5660, 0x5642, 0x55c6, 0x554a, 0x5463, 0x5456,
+         0x53e2, 0x544a, 0x543c, 0x53d2, 0x5360, 0x5360, 0x5360, 0x5360,
+         0x5360, 0x5360, 0x5360, 0x53d4, 0x53d4, 0x53d4, 0x6752, 0x69d6,
+         0x6a5a, 0x6ae2, 0x6ae3, 0x723c, 0x71c4, 0x71c2, 0x71c2, 0x71cd},
+        {0x64df, 0x64df, 0x64df, 0x64df, 0x64df, 0x5bde, 0x5ada, 0x5ad9,
+         0x59da, 0x575c, 0x5660, 0x564b, 0x55cf, 0x5554, 0x5548, 0x5463,
+         0x5464, 0x5456, 0x5456, 0x5456, 0x53d2, 0x535f, 0x535f, 0x535f,
+         0x535f, 0x535f, 0x535f, 0x535f, 0x53d2, 0x53d2, 0x66d4, 0x69d6,
+         0x6a5a, 0x6ae2, 0x6ae3, 0x7345, 0x72bf, 0x7247, 0x7247, 0x72d8},
+        {0x645e, 0x645e, 0x625a, 0x645e, 0x645e, 0x5b62, 0x5ada, 0x5ada,
+         0x59e4, 0x575c, 0x5660, 0x564b, 0x55cf, 0x555f, 0x4663, 0x46df,
+         0x475e, 0x49e2, 0x5456, 0x5456, 0x53e1, 0x53e1, 0x53e1, 0x53e1,
+         0x53e1, 0x53e2, 0x5456, 0x5456, 0x5456, 0x53e1, 0x66d4, 0x69ce,
+         0x6a4f, 0x6ad6, 0x6ae3, 0x7350, 0x6b63, 0x72cb, 0x72cb, 0x72e0},
+        {0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6259, 0x5b62,
+         0x5a5e, 0x59d9, 0x58da, 0x56d3, 0x55dc, 0x5560, 0x4664, 0x46e0,
+         0x475c, 0x49e1, 0x5464, 0x5463, 0x53e2, 0x53e2, 0x53e2, 0x53e2,
+         0x53e2, 0x53e2, 0x5456, 0x5456, 0x5456, 0x5456, 0x66cc, 0x69cc,
+         0x6a4f, 0x6ad6, 0x6ae3, 0x6b64, 0x6b63, 0x7352, 0x72e0, 0x72e0},
+        {0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x5b62,
+         0x5a5e, 0x59da, 0x58da, 0x5660, 0x5656, 0x55da, 0x555f, 0x555f,
+         0x5556, 0x54da, 0x54da, 0x5463, 0x5464, 0x5464, 0x5464, 0x55d0,
+         0x5554, 0x5554, 0x54dc, 0x5464, 0x5464, 0x5464, 0x66cc, 0x69cc,
+         0x6ad5, 0x6b5c, 0x6b5c, 0x6b64, 0x73d2, 0x73db, 0x7360, 0x7360},
+        {0x7463, 0x755f, 0x75dc, 0x7560, 0x755f, 0x755f, 0x7556, 0x74da,
+         0x755f, 0x595f, 0x585f, 0x56dd, 0x5660, 0x5660, 0x55dc, 0x5560,
+         0x555f, 0x555f, 0x555f, 0x5556, 0x5463, 0x5463, 0x5463, 0x5463,
+         0x55cf, 0x5556, 0x54da, 0x54da, 0x5463, 0x5463, 0x6ed4, 0x7556,
+         0x7556, 0x74da, 0x7463, 0x7463, 0x7463, 0x7463, 0x802a, 0x8028},
+        {0x7d54, 0x7d47, 0x7d47, 0x7cc2, 0x7c3a, 0x7c3a, 0x7c2d, 0x7b2c,
+         0x79a2, 0x7414, 0x71c2, 0x7162, 0x7162, 0x7162, 0x7162, 0x7162,
+         0x7162, 0x7162, 0x7162, 0x7162, 0x7162, 0x7162, 0x7162, 0x7162,
+         0x7162, 0x7162, 0x7162, 0x7162, 0x7162, 0x7162, 0x7162, 0x8c15,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x7cd8, 0x7cd8, 0x7ccc, 0x7cc2, 0x7c3a, 0x7bc1, 0x7bb4, 0x7b2d,
+         0x79a2, 0x749e, 0x7247, 0x71df, 0x71df, 0x71df, 0x71df, 0x71df,
+         0x71df, 0x71df, 0x71df, 0x71df, 0x71df, 0x71df, 0x71df, 0x71df,
+         0x71df, 0x71df, 0x71df, 0x71df, 0x71df, 0x71df, 0x71df, 0x8c15,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x7cd9, 0x7cce, 0x7c54, 0x7c47, 0x7c3e, 0x7bc4, 0x7b3c, 0x7ab5,
+         0x79a3, 0x7526, 0x72cb, 0x725e, 0x725e, 0x725e, 0x725e, 0x725e,
+         0x725e, 0x725e, 0x725e, 0x725e, 0x725e, 0x725e, 0x725e, 0x725e,
+         0x725e, 0x725e, 0x725e, 0x725e, 0x725e, 0x725e, 0x725e, 0x8c15,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x7cd9, 0x7c56, 0x7c54, 0x7bcf, 0x7bc2, 0x7bc2, 0x7b3b, 0x7ab5,
+         0x7933, 0x75ae, 0x72e0, 0x72de, 0x72de, 0x72de, 0x72de, 0x72de,
+         0x72de, 0x72de, 0x72de, 0x72de, 0x72de, 0x72de, 0x72de, 0x72de,
+         0x72de, 0x72de, 0x72de, 0x72de, 0x72de, 0x72de, 0x72de, 0x89e2,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x7c61, 0x7c61, 0x7bdd, 0x7bdd, 0x7bd0, 0x7b4c, 0x7ac8, 0x7a44,
+         0x79bc, 0x7638, 0x7360, 0x7360, 0x7360, 0x7360, 0x7360, 0x7360,
+         0x7360, 0x7360, 0x7360, 0x7360, 0x7360, 0x7360, 0x7360, 0x7360,
+         0x7360, 0x7360, 0x7360, 0x7360, 0x7360, 0x7360, 0x875c, 0x89e1,
+         0x92a6, 0x9230, 0x9230, 0x923c, 0x91c4, 0x91c2, 0x91c2, 0x91cd},
+        {0x84df, 0x7c5b, 0x7be0, 0x7bd2, 0x7b4b, 0x7b4b, 0x7ac7, 0x7a42,
+         0x7936, 0x7636, 0x73d2, 0x735f, 0x735f, 0x735f, 0x735f, 0x735f,
+         0x735f, 0x735f, 0x735f, 0x735f, 0x735f, 0x735f, 0x735f, 0x735f,
+         0x735f, 0x735f, 0x735f, 0x735f, 0x735f, 0x735f, 0x735f, 0x89d6,
+         0x8a5a, 0x8ae2, 0x8ae3, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x84df, 0x7bde, 0x7bde, 0x7b5b, 0x7b56, 0x7b54, 0x7acd, 0x7a47,
+         0x7942, 0x7641, 0x73e1, 0x73e1, 0x73e1, 0x73e1, 0x73e1, 0x73e1,
+         0x73e1, 0x73e1, 0x73e1, 0x73e1, 0x73e1, 0x73e1, 0x73e1, 0x73e1,
+         0x73e1, 0x73e1, 0x73e1, 0x73e1, 0x73e1, 0x73e1, 0x86cc, 0x89cc,
+         0x8a5a, 0x8ae2, 0x8ae3, 0x8b64, 0x91c4, 0x91c2, 0x91c2, 0x91cd},
+        {0x8357, 0x7bde, 0x7bde, 0x7b5b, 0x7b56, 0x7ad9, 0x7a58, 0x79d8,
+         0x7942, 0x7642, 0x73e2, 0x73e2, 0x73e2, 0x73e2, 0x73e2, 0x73e2,
+         0x73e2, 0x73e2, 0x73e2, 0x73e2, 0x73e2, 0x73e2, 0x73e2, 0x73e2,
+         0x73e2, 0x73e2, 0x73e2, 0x73e2, 0x73e2, 0x73e2, 0x86d4, 0x89ca,
+         0x8a4e, 0x8ad2, 0x8ae3, 0x9345, 0x8b63, 0x8c63, 0x8c63, 0x92d8},
+        {0x8253, 0x8253, 0x8253, 0x8253, 0x7b61, 0x7ad9, 0x7a58, 0x79d8,
+         0x79d0, 0x764c, 0x7464, 0x7464, 0x7464, 0x7464, 0x7464, 0x7464,
+         0x7464, 0x7464, 0x7464, 0x7464, 0x7464, 0x7464, 0x7464, 0x7464,
+         0x7464, 0x7464, 0x7464, 0x7464, 0x7464, 0x7464, 0x86c0, 0x89c9,
+         0x8a4f, 0x8ad6, 0x8ae3, 0x8bd8, 0x8b63, 0x8c64, 0x92cb, 0x9360},
+    },
+    {
+        {0x4048, 0x403e, 0x403c, 0x4032, 0x402a, 0x4028, 0x401e, 0x4014,
+         0x4006, 0x235a, 0x2357, 0x2357, 0x2357, 0x235a, 0x2357, 0x2357,
+         0x2357, 0x2357, 0x2358, 0x23ca, 0x4ed4, 0x49c9, 0x4a4e, 0x4ad2,
+         0x4ae3, 0x4b64, 0x4b63, 0x4c59, 0x4c5a, 0x4cdd, 0x4cde, 0x69c9,
+         0x6a4e, 0x6ad2, 0x6ae3, 0x6b64, 0x6b63, 0x6c59, 0x6c5a, 0x6cdd},
+        {0x5d54, 0x5d47, 0x5d47, 0x5cc2, 0x5c3a, 0x5c3a, 0x5c2d, 0x5b2c,
+         0x59a2, 0x22d6, 0x22d6, 0x22d6, 0x22d6, 0x22d6, 0x22d6, 0x22d6,
+         0x22d6, 0x22d6, 0x2346, 0x2346, 0x4ed4, 0x49c9, 0x4a4e, 0x4ad2,
+         0x4ae3, 0x4b64, 0x4b63, 0x4c59, 0x4c5a, 0x4cdd, 0x4cde, 0x69c9,
+         0x6a4e, 0x6ad2, 0x6ae3, 0x6b64, 0x6b63, 0x6c59, 0x6c5a, 0x6cdd},
+        {0x5cd8, 0x5c56, 0x5c54, 0x5bcf, 0x5bc2, 0x5bc1, 0x5b3b, 0x5ab5,
+         0x5933, 0x2253, 0x2253, 0x2253, 0x2253, 0x2253, 0x2253, 0x2253,
+         0x2253, 0x2253, 0x22c2, 0x22c2, 0x2cde, 0x4c15, 0x4d9a, 0x4db0,
+         0x4db0, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9, 0x4f47, 0x6c15,
+         0x6d9a, 0x6db0, 0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x5c61, 0x5bde, 0x5bdd, 0x5b5b, 0x5b4b, 0x5b4b, 0x5ac7, 0x5a42,
+         0x5933, 0x21d5, 0x21d4, 0x21d2, 0x21d2, 0x21d2, 0x21d2, 0x21d2,
+         0x21d2, 0x21d2, 0x21d2, 0x21d4, 0x2d56, 0x4c15, 0x4d9a, 0x4db0,
+         0x4db0, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9, 0x4f47, 0x6c15,
+         0x6d9a, 0x6db0, 0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x5c61, 0x5bde, 0x5bdd, 0x5b5b, 0x5ada, 0x5ad9, 0x5a57, 0x4663,
+         0x4663, 0x2046, 0x203c, 0x203e, 0x202a, 0x2032, 0x2020, 0x2014,
+         0x2002, 0x2002, 0x2028, 0x201e, 0x2e4e, 0x49e1, 0x4d9a, 0x4db0,
+         0x4db0, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9, 0x4f47, 0x69e1,
+         0x6d9a, 0x6db0, 0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x5c61, 0x5bde, 0x5bdd, 0x5b5b, 0x4563, 0x4563, 0x45de, 0x465b,
+         0x465a, 0x3dce, 0x3dc3, 0x3162, 0x3162, 0x3162, 0x38b6, 0x30ae,
+         0x30ae, 0x30ae, 0x30ae, 0x30ae, 0x30ca, 0x49d6, 0x4a5a, 0x4ae2,
+         0x4ae3, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9, 0x4f47, 0x69d6,
+         0x6a5a, 0x6ae2, 0x6ae3, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x5c61, 0x5bde, 0x5bdd, 0x44df, 0x455e, 0x455e, 0x4557, 0x45d2,
+         0x45d2, 0x3dda, 0x3cd8, 0x31df, 0x3bcf, 0x31e2, 0x3c62, 0x31c2,
+         0x3162, 0x3162, 0x3162, 0x3162, 0x3162, 0x49cc, 0x4a4f, 0x4ad6,
+         0x4ae3, 0x4b64, 0x4b63, 0x4e41, 0x4ebf, 0x4ec9, 0x4f47, 0x69cc,
+         0x6a4f, 0x6ad6, 0x6ae3, 0x6b64, 0x6b63, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x5c61, 0x445f, 0x445f, 0x445e, 0x44d3, 0x44d3, 0x454e, 0x44d3,
+         0x45d1, 0x4642, 0x3c54, 0x325e, 0x3b5b, 0x4028, 0x3c62, 0x32cb,
+         0x325e, 0x325e, 0x325d, 0x325d, 0x325d, 0x49c9, 0x4a4e, 0x4ad2,
+         0x4ae3, 0x4b64, 0x4b63, 0x4c59, 0x4c5a, 0x4ce1, 0x4cde, 0x69c9,
+         0x6a4e, 0x6ad2, 0x6ae3, 0x6b64, 0x6b63, 0x6c59, 0x6c5a, 0x6ce1},
+        {0x5c61, 0x445f, 0x445f, 0x445e, 0x445c, 0x44d3, 0x44d4, 0x43e2,
+         0x44c6, 0x4642, 0x3bdd, 0x32e2, 0x403e, 0x39e3, 0x3cda, 0x333e,
+         0x325e, 0x32cb, 0x32cb, 0x32cb, 0x325e, 0x49c9, 0x4a4e, 0x4ad2,
+         0x4ae3, 0x4b64, 0x4b63, 0x4c59, 0x4c5a, 0x4cdd, 0x4cde, 0x69c9,
+         0x6a4e, 0x6ad2, 0x6ae3, 0x6b64, 0x6b63, 0x6c59, 0x6c5a, 0x6cdd},
+        {0x5c61, 0x43da, 0x43da, 0x4452, 0x444e, 0x444e, 0x44c6, 0x4542,
+         0x42d6, 0x41e0, 0x41e0, 0x41d4, 0x41e2, 0x423a, 0x3cda, 0x334f,
+         0x32e2, 0x334f, 0x334f, 0x32de, 0x32de, 0x49c9, 0x4a4e, 0x4ad2,
+         0x4b52, 0x4b64, 0x4bd6, 0x4c59, 0x4c5a, 0x4cdd, 0x4cde, 0x69c9,
+         0x6a4e, 0x6ad2, 0x6b52, 0x6b64, 0x6bd6, 0x6c59, 0x6c5a, 0x6cdd},
+        {0x405a, 0x405a, 0x4064, 0x5b62, 0x5ada, 0x5ada, 0x4052, 0x59d6,
+         0x4050, 0x405c, 0x405c, 0x4048, 0x4034, 0x403c, 0x3c62, 0x33d2,
+         0x33d2, 0x33d2, 0x3360, 0x335f, 0x335f, 0x4c15, 0x4d9a, 0x4db0,
+         0x4db0, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9, 0x4f47, 0x6c15,
+         0x6d9a, 0x6db0, 0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x5de3, 0x5dda, 0x5dda, 0x5dd8, 0x5d52, 0x5d52, 0x5d47, 0x5cc2,
+         0x5bc1, 0x56b4, 0x54c2, 0x5360, 0x534f, 0x3c62, 0x3ac7, 0x37db,
+         0x33d2, 0x33d2, 0x33d2, 0x33db, 0x335f, 0x4c15, 0x4d9a, 0x4db0,
+         0x4db0, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9, 0x4f47, 0x6c15,
+         0x6d9a, 0x6db0, 0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x5d5e, 0x5d5e, 0x5ce4, 0x5ce4, 0x5cd9, 0x5cce, 0x5cce, 0x5bdd,
+         0x5ab6, 0x56c0, 0x5548, 0x54d0, 0x53c6, 0x52de, 0x3a57, 0x3752,
+         0x3456, 0x33e2, 0x33e2, 0x33e2, 0x525d, 0x52a5, 0x52a6, 0x5230,
+         0x5230, 0x523c, 0x51c4, 0x51c2, 0x51c2, 0x51cd, 0x51ce, 0x6c15,
+         0x6d9a, 0x6db0, 0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x5dda, 0x5dda, 0x5d5d, 0x5cda, 0x5c61, 0x5c56, 0x5c56, 0x5b3b,
+         0x5ac7, 0x56c9, 0x55c6, 0x54c2, 0x544a, 0x3ad9, 0x3a57, 0x39d6,
+         0x38d8, 0x3464, 0x3463, 0x3554, 0x535f, 0x53a7, 0x53a7, 0x532e,
+         0x52ba, 0x5345, 0x52bf, 0x5247, 0x5247, 0x52d8, 0x5252, 0x6c15,
+         0x6d9a, 0x6db0, 0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x5d5e, 0x5d5e, 0x5d5e, 0x5c62, 0x5c62, 0x5c61, 0x5b4b, 0x5ace,
+         0x5a57, 0x56c0, 0x55c4, 0x4663, 0x4663, 0x3ada, 0x3a57, 0x39d6,
+         0x38d8, 0x364b, 0x3463, 0x3560, 0x54aa, 0x542f, 0x542f, 0x53b6,
+         0x533e, 0x5350, 0x5346, 0x52cb, 0x52cb, 0x52e0, 0x52d7, 0x69e1,
+         0x6d9a, 0x6db0, 0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x5dda, 0x5d5e, 0x5ce4, 0x5cda, 0x5c62, 0x5c56, 0x5b54, 0x5acd,
+         0x4563, 0x4563, 0x4563, 0x3b62, 0x3ada, 0x3ada, 0x3a57, 0x39d6,
+         0x38d8, 0x364b, 0x35cf, 0x3560, 0x5531, 0x54b6, 0x543c, 0x53c4,
+         0x53c4, 0x5350, 0x534f, 0x5352, 0x52e0, 0x52e0, 0x52de, 0x69d6,
+         0x6a5a, 0x6ae2, 0x6ae3, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x5d5e, 0x5d5e, 0x5d54, 0x5ce4, 0x5c61, 0x44df, 0x44df, 0x455e,
+         0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x3a5e, 0x39d9,
+         0x38d8, 0x3658, 0x35dc, 0x3560, 0x553d, 0x54c2, 0x54c2, 0x5449,
+         0x5449, 0x53d4, 0x53d2, 0x53db, 0x5360, 0x5360, 0x535f, 0x69cc,
+         0x6a4f, 0x6ad6, 0x6ae3, 0x6b64, 0x6b63, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x5d5d, 0x5d52, 0x5cd8, 0x5c62, 0x5c62, 0x5b62, 0x445f, 0x44df,
+         0x445e, 0x445e, 0x445e, 0x445e, 0x445e, 0x445e, 0x3a5e, 0x39da,
+         0x38da, 0x3660, 0x3656, 0x35da, 0x475e, 0x49e2, 0x54c2, 0x54c3,
+         0x544a, 0x5458, 0x53d2, 0x53db, 0x53db, 0x6014, 0x535f, 0x69c9,
+         0x6a4e, 0x6ad2, 0x6ae3, 0x6b64, 0x6b63, 0x6c59, 0x6c5a, 0x6ce1},
+        {0x5d5e, 0x5d5a, 0x5ce4, 0x445f, 0x435a, 0x435a, 0x4357, 0x4357,
+         0x435a, 0x4357, 0x4357, 0x4357, 0x4357, 0x4357, 0x4357, 0x39e3,
+         0x38dc, 0x3660, 0x3660, 0x4014, 0x475c, 0x49e1, 0x54d0, 0x54ce,
+         0x5456, 0x5458, 0x53e1, 0x53e1, 0x53e2, 0x6014, 0x662d, 0x69c9,
+         0x6a4e, 0x6ad2, 0x6ae3, 0x6b64, 0x6b63, 0x6c59, 0x6c5a, 0x6cdd},
+        {0x5ce4, 0x4264, 0x425a, 0x425a, 0x4259, 0x4253, 0x4253, 0x4253,
+         0x4052, 0x4259, 0x4253, 0x4253, 0x4253, 0x4253, 0x4253, 0x39e3,
+         0x38de, 0x36de, 0x3662, 0x411f, 0x55c6, 0x554a, 0x554a, 0x54ce,
+         0x5456, 0x5464, 0x545a, 0x53e2, 0x53e2, 0x611f, 0x6622, 0x69c9,
+         0x6a4e, 0x6ad2, 0x6b52, 0x6b64, 0x6bd6, 0x6c59, 0x6c5a, 0x6cdd},
+        {0x7463, 0x7463, 0x7463, 0x7463, 0x755f, 0x7556, 0x74da, 0x59e3,
+         0x595f, 0x57db, 0x5360, 0x5656, 0x55da, 0x555f, 0x555f, 0x39e3,
+         0x38de, 0x36de, 0x3662, 0x4014, 0x55cf, 0x55cf, 0x5560, 0x5556,
+         0x54da, 0x6052, 0x5463, 0x603e, 0x603c, 0x6032, 0x6ed4, 0x75cf,
+         0x7560, 0x7556, 0x74da, 0x805a, 0x7463, 0x8048, 0x803e, 0x803c},
+        {0x7162, 0x7162, 0x7162, 0x7162, 0x7c2d, 0x7b2c, 0x79a2, 0x7414,
+         0x72a5, 0x5dd8, 0x51cd, 0x5162, 0x5162, 0x5162, 0x5162, 0x5162,
+         0x5162, 0x5162, 0x52a5, 0x5230, 0x6ed4, 0x71c2, 0x71c2, 0x7164,
+         0x7162, 0x7162, 0x7164, 0x7164, 0x7162, 0x7162, 0x7162, 0x8c15,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x71df, 0x71df, 0x71e2, 0x71e2, 0x7bb4, 0x7b2d, 0x79a2, 0x5b5b,
+         0x6028, 0x5d5d, 0x52d8, 0x51df, 0x51df, 0x51df, 0x51df, 0x51e2,
+         0x51e2, 0x51e2, 0x532e, 0x52ba, 0x6ed4, 0x7247, 0x71df, 0x7247,
+         0x71e2, 0x71df, 0x71df, 0x71df, 0x71df, 0x71df, 0x71df, 0x8c15,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x7162, 0x7162, 0x7164, 0x7162, 0x7ac7, 0x7a42, 0x7936, 0x7414,
+         0x59e3, 0x5ce4, 0x52e0, 0x525e, 0x525e, 0x525e, 0x525e, 0x5526,
+         0x54aa, 0x542f, 0x53b6, 0x533e, 0x6ed4, 0x72cb, 0x725e, 0x72cb,
+         0x72cb, 0x725e, 0x725e, 0x725e, 0x725e, 0x725e, 0x725e, 0x8c15,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x7164, 0x7164, 0x7162, 0x71e2, 0x7a58, 0x79d8, 0x7933, 0x749e,
+         0x7414, 0x5ce4, 0x52e0, 0x52de, 0x52de, 0x52e2, 0x52e2, 0x55ae,
+         0x54b8, 0x543c, 0x543c, 0x53c4, 0x6ed4, 0x72e4, 0x72e0, 0x72de,
+         0x72de, 0x72de, 0x72de, 0x72de, 0x72de, 0x72de, 0x72de, 0x89e2,
+         0x8d9a, 0x8db0, 0x8db0, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x725e, 0x725e, 0x71e2, 0x7ad9, 0x7a57, 0x79d6, 0x6663, 0x6663,
+         0x6663, 0x6663, 0x5360, 0x5360, 0x5ac8, 0x5a44, 0x59bc, 0x5638,
+         0x553d, 0x54c4, 0x54c4, 0x5449, 0x6ed4, 0x73d4, 0x7360, 0x7360,
+         0x7360, 0x7360, 0x7360, 0x7360, 0x7360, 0x7360, 0x875c, 0x89e1,
+         0x92a6, 0x9230, 0x9230, 0x923c, 0x91c4, 0x91c2, 0x91c2, 0x91cd},
+        {0x72e2, 0x72e2, 0x7ada, 0x7ad9, 0x6563, 0x6563, 0x65de, 0x665b,
+         0x665a, 0x665a, 0x5b4b, 0x535f, 0x535f, 0x5a42, 0x5936, 0x5636,
+         0x5548, 0x54c2, 0x54c2, 0x544a, 0x6ed4, 0x73d2, 0x73d2, 0x735f,
+         0x735f, 0x735f, 0x735f, 0x735f, 0x735f, 0x735f, 0x735f, 0x89d6,
+         0x8a5a, 0x8ae2, 0x8ae3, 0x8e38, 0x8e41, 0x8e41, 0x8ebf, 0x8ec9},
+        {0x7bdd, 0x7b5b, 0x7ada, 0x6563, 0x6563, 0x6563, 0x6563, 0x65dd,
+         0x65de, 0x6658, 0x5b56, 0x5b54, 0x5acd, 0x5a47, 0x5942, 0x5641,
+         0x5548, 0x54d0, 0x54ce, 0x5456, 0x6ed4, 0x73e1, 0x73e1, 0x73e1,
+         0x73e1, 0x73e1, 0x73e1, 0x73e1, 0x73e1, 0x73e1, 0x86cc, 0x89cc,
+         0x8a5a, 0x8ae2, 0x8ae3, 0x8b64, 0x91c4, 0x91c2, 0x91c2, 0x91cd},
+        {0x7bde, 0x7b5b, 0x6563, 0x64df, 0x655e, 0x655e, 0x6557, 0x6563,
+         0x6563, 0x635a, 0x5b56, 0x5ad9, 0x5a58, 0x59d8, 0x5942, 0x5642,
+         0x55c6, 0x554a, 0x54ce, 0x5456, 0x6cde, 0x73e2, 0x73e2, 0x73e2,
+         0x73e2, 0x73e2, 0x73e2, 0x73e2, 0x73e2, 0x73e2, 0x86d4, 0x89ca,
+         0x8a4e, 0x8ad2, 0x8ae3, 0x9345, 0x8b63, 0x8c63, 0x8c63, 0x92d8},
+        {0x7be0, 0x7bde, 0x6563, 0x64df, 0x655e, 0x655e, 0x6557, 0x6563,
+         0x6563, 0x6253, 0x5b61, 0x5ad9, 0x5a58, 0x59d8, 0x59d0, 0x564c,
+         0x55d0, 0x5554, 0x5554, 0x54dc, 0x6cde, 0x7464, 0x7464, 0x7464,
+         0x7464, 0x7464, 0x7464, 0x7464, 0x7464, 0x7464, 0x86c0, 0x89c9,
+         0x8a4f, 0x8ad6, 0x8ae3, 0x8bd8, 0x8b63, 0x8c64, 0x92cb, 0x9360},
+    },
+    {
+        {0x6046, 0x603e, 0x603c, 0x6032, 0x602a, 0x6028, 0x6563, 0x6563,
+         0x6563, 0x4563, 0x4563, 0x4563, 0x4563, 0x4563, 0x4563, 0x4563,
+         0x4563, 0x4563, 0x4563, 0x4563, 0x44e0, 0x44e0, 0x44e0, 0x44e0,
+         0x44e0, 0x44e0, 0x44e0, 0x44e0, 0x44e0, 0x44e0, 0x6ed4, 0x64e0,
+         0x64e0, 0x64e0, 0x64e0, 0x64e0, 0x64e0, 0x64e0, 0x64e0, 0x64e0},
+        {0x7d52, 0x7d47, 0x7d47, 0x7cc2, 0x7c3a, 0x7c3a, 0x6563, 0x6563,
+         0x6563, 0x4563, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df,
+         0x44df, 0x44df, 0x44df, 0x44df, 0x445e, 0x445e, 0x445e, 0x445e,
+         0x445e, 0x445e, 0x445e, 0x445e, 0x445e, 0x445e, 0x6ed4, 0x645e,
+         0x645e, 0x645e, 0x645e, 0x645e, 0x645e, 0x645e, 0x645e, 0x645e},
+        {0x7cd8, 0x7c56, 0x7c54, 0x7bcf, 0x7bc2, 0x64df, 0x64df, 0x44df,
+         0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df, 0x44df,
+         0x44df, 0x44df, 0x44df, 0x44df, 0x445c, 0x445c, 0x445c, 0x445c,
+         0x445c, 0x445c, 0x445c, 0x445c, 0x445c, 0x445c, 0x6ed4, 0x645c,
+         0x645c, 0x645c, 0x645c, 0x645c, 0x645c, 0x645c, 0x645c, 0x645c},
+        {0x7162, 0x7162, 0x7162, 0x7162, 0x7ac7, 0x7a42, 0x64df, 0x64df,
+         0x445f, 0x445f, 0x445e, 0x445e, 0x445e, 0x445e, 0x445e, 0x445e,
+         0x445e, 0x445e, 0x445e, 0x43e2, 0x43da, 0x43da, 0x43da, 0x43da,
+         0x43da, 0x43da, 0x43da, 0x43da, 0x43da, 0x43da, 0x6ed4, 0x63da,
+         0x63da, 0x63da, 0x63da, 0x63da, 0x63da, 0x63da, 0x63da, 0x63da},
+        {0x7164, 0x7164, 0x7162, 0x71e2, 0x7a58, 0x445f, 0x445f, 0x445e,
+         0x445e, 0x445e, 0x445e, 0x43e2, 0x445c, 0x445c, 0x445c, 0x445c,
+         0x445c, 0x445c, 0x445c, 0x435a, 0x4357, 0x4357, 0x4357, 0x4357,
+         0x4357, 0x4357, 0x4357, 0x4357, 0x4357, 0x4357, 0x6ed4, 0x6357,
+         0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357},
+        {0x6563, 0x6563, 0x6563, 0x6563, 0x6563, 0x6563, 0x43e2, 0x43e2,
+         0x43da, 0x43da, 0x43da, 0x43da, 0x43e4, 0x43da, 0x43e2, 0x43da,
+         0x43da, 0x43da, 0x444e, 0x435a, 0x4357, 0x4357, 0x4357, 0x4357,
+         0x4357, 0x4357, 0x4357, 0x4357, 0x4357, 0x4357, 0x6ed4, 0x6357,
+         0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357},
+        {0x64df, 0x64df, 0x64df, 0x64df, 0x64df, 0x6357, 0x435a, 0x435a,
+         0x4357, 0x4357, 0x4357, 0x4357, 0x43ca, 0x4357, 0x435a, 0x4357,
+         0x4357, 0x4357, 0x43ca, 0x42d6, 0x42d5, 0x42d5, 0x42d5, 0x42d5,
+         0x42d5, 0x42d5, 0x42d5, 0x42d5, 0x4345, 0x4345, 0x6ed4, 0x62d5,
+         0x62d5, 0x62d5, 0x62d5, 0x62d5, 0x62d5, 0x62d5, 0x62d5, 0x62d5},
+        {0x645e, 0x645e, 0x625a, 0x645e, 0x645e, 0x645e, 0x6358, 0x435a,
+         0x4357, 0x4357, 0x4357, 0x4357, 0x42de, 0x42de, 0x42d6, 0x4346,
+         0x4357, 0x4357, 0x4357, 0x4253, 0x4253, 0x4253, 0x4253, 0x4253,
+         0x4253, 0x4253, 0x4253, 0x4254, 0x42c0, 0x42c0, 0x6cde, 0x6253,
+         0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253},
+        {0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6357, 0x6259, 0x62c2,
+         0x42d5, 0x42d5, 0x425a, 0x425a, 0x425a, 0x42d6, 0x42d5, 0x42c2,
+         0x42d5, 0x4345, 0x4345, 0x4152, 0x4152, 0x4152, 0x4152, 0x4152,
+         0x4152, 0x4152, 0x4152, 0x41b2, 0x41b2, 0x41b2, 0x6cde, 0x6152,
+         0x6152, 0x6152, 0x6152, 0x6152, 0x6152, 0x6152, 0x6152, 0x6152},
+        {0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253, 0x6253,
+         0x6052, 0x41e0, 0x41d5, 0x4253, 0x41e0, 0x41d5, 0x41d4, 0x41d5,
+         0x41d2, 0x41d2, 0x423a, 0x40d2, 0x40d2, 0x40d2, 0x40d2, 0x40d2,
+         0x4046, 0x264e, 0x26ca, 0x294a, 0x2a4f, 0x24df, 0x4002, 0x49d6,
+         0x4a5a, 0x4ae2, 0x4ae3, 0x4eb5, 0x4f3d, 0x4f3d, 0x4f48, 0x4f48},
+        {0x6254, 0x6254, 0x62c8, 0x62c2, 0x62c0, 0x6335, 0x6333, 0x6334,
+         0x63ab, 0x4152, 0x4052, 0x4052, 0x4052, 0x4050, 0x4048, 0x403e,
+         0x403c, 0x4050, 0x402a, 0x402a, 0x4152, 0x51ce, 0x4152, 0x4152,
+         0x4046, 0x235a, 0x235a, 0x2357, 0x2357, 0x2357, 0x2cde, 0x4c15,
+         0x4d9a, 0x4db0, 0x4db0, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9},
+        {0x61d4, 0x61c2, 0x61c2, 0x61b6, 0x61b2, 0x61b2, 0x6223, 0x6222,
+         0x6222, 0x4046, 0x4032, 0x402a, 0x4028, 0x401e, 0x4014, 0x4006,
+         0x235a, 0x235a, 0x2357, 0x2357, 0x4052, 0x245c, 0x403e, 0x2663,
+         0x4014, 0x235a, 0x235a, 0x2357, 0x2357, 0x2357, 0x2cde, 0x4c15,
+         0x4d9a, 0x4db0, 0x4db0, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9},
+        {0x6048, 0x603e, 0x603c, 0x6032, 0x602a, 0x6028, 0x601e, 0x6014,
+         0x6006, 0x5dce, 0x5d3e, 0x5162, 0x5162, 0x22de, 0x22de, 0x22de,
+         0x22d6, 0x22d6, 0x22d6, 0x234e, 0x2357, 0x4046, 0x245e, 0x25c6,
+         0x22de, 0x22d6, 0x22d5, 0x22d5, 0x22d5, 0x22d5, 0x2cde, 0x4c15,
+         0x4d9a, 0x4db0, 0x4db0, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9},
+        {0x7d54, 0x7bde, 0x7bde, 0x7b5b, 0x7b4b, 0x7b4b, 0x7ac7, 0x7a42,
+         0x7936, 0x5d52, 0x4243, 0x4253, 0x5162, 0x43cc, 0x225a, 0x225a,
+         0x2253, 0x2253, 0x22ca, 0x2253, 0x22d5, 0x22de, 0x2358, 0x24ba,
+         0x2259, 0x2253, 0x2253, 0x2253, 0x2253, 0x2254, 0x2cde, 0x4c15,
+         0x4d9a, 0x4db0, 0x4db0, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9},
+        {0x7cd8, 0x7bde, 0x7bde, 0x7b5b, 0x7ada, 0x7ad9, 0x7a57, 0x6663,
+         0x6663, 0x5d52, 0x403e, 0x4034, 0x4052, 0x4028, 0x21d6, 0x21d6,
+         0x21d2, 0x21d2, 0x21d2, 0x21d2, 0x21d2, 0x21d6, 0x223a, 0x22c0,
+         0x2152, 0x2152, 0x2151, 0x2151, 0x2151, 0x2151, 0x2dd2, 0x49e1,
+         0x4d9a, 0x4db0, 0x4db0, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9},
+        {0x7cd8, 0x7bde, 0x7bde, 0x7b5b, 0x6563, 0x6563, 0x65de, 0x665b,
+         0x665a, 0x5cda, 0x4563, 0x45de, 0x465b, 0x465a, 0x2052, 0x2052,
+         0x2046, 0x2046, 0x203e, 0x203c, 0x2032, 0x2032, 0x202a, 0x201e,
+         0x2016, 0x2006, 0x2002, 0x203e, 0x203c, 0x2032, 0x2eca, 0x49d6,
+         0x4a5a, 0x4ae2, 0x4ae3, 0x4e38, 0x4e41, 0x4e41, 0x4ebf, 0x4ec9},
+        {0x7cd8, 0x7c56, 0x7c54, 0x64df, 0x655e, 0x655e, 0x6557, 0x65d2,
+         0x65d2, 0x5cda, 0x455e, 0x4557, 0x45d2, 0x45d2, 0x3e56, 0x3e56,
+         0x3e4a, 0x3dce, 0x3dc3, 0x3dc3, 0x24df, 0x255e, 0x255e, 0x2557,
+         0x25d2, 0x264e, 0x26ca, 0x294a, 0x2a4f, 0x24df, 0x314a, 0x49cc,
+         0x4a4f, 0x4ad6, 0x4ae3, 0x4b64, 0x4b63, 0x4e41, 0x4ebf, 0x4ec9},
+        {0x7c61, 0x645f, 0x645f, 0x645e, 0x64d3, 0x64d3, 0x654e, 0x6558,
+         0x65c6, 0x5c62, 0x44d3, 0x454e, 0x4558, 0x45c6, 0x3dda, 0x3dd8,
+         0x3d52, 0x3d52, 0x3d47, 0x3d47, 0x24df, 0x24df, 0x255c, 0x2557,
+         0x2558, 0x25d1, 0x26ca, 0x294a, 0x2a4f, 0x24df, 0x31df, 0x49c9,
+         0x4a4e, 0x4ad2, 0x4ae3, 0x4b64, 0x4b63, 0x4c59, 0x4c5a, 0x4ce1},
+        {0x635c, 0x6357, 0x6357, 0x6358, 0x63cc, 0x6443, 0x6440, 0x6440,
+         0x64b9, 0x5c62, 0x4443, 0x4440, 0x4440, 0x44b9, 0x3d5e, 0x3d5d,
+         0x3d5d, 0x3cd8, 0x245f, 0x245f, 0x245e, 0x245e, 0x24d3, 0x254e,
+         0x2558, 0x25d1, 0x26c2, 0x245f, 0x245f, 0x245e, 0x32de, 0x49c9,
+         0x4a4e, 0x4ad2, 0x4ae3, 0x4b64, 0x4b63, 0x4c59, 0x4c5a, 0x4cdd},
+        {0x6254, 0x6254, 0x62c8, 0x62c2, 0x62c0, 0x6335, 0x6333, 0x6334,
+         0x63ab, 0x6253, 0x4335, 0x4333, 0x4334, 0x43ab, 0x4253, 0x3ce4,
+         0x3ce4, 0x3cd9, 0x20db, 0x3c54, 0x245e, 0x245e, 0x24d3, 0x254e,
+         0x2558, 0x25d1, 0x26c2, 0x245f, 0x245f, 0x245e, 0x451c, 0x49c9,
+         0x4a4e, 0x4ad2, 0x4b52, 0x4b64, 0x4bd6, 0x4c59, 0x4c5a, 0x4cdd},
+        {0x8032, 0x802a, 0x8028, 0x7b62, 0x7ada, 0x7ada, 0x7a5e, 0x79da,
+         0x78da, 0x76d3, 0x603c, 0x603e, 0x602a, 0x6032, 0x6020, 0x7b62,
+         0x7a5e, 0x59e3, 0x595f, 0x575c, 0x533e, 0x5656, 0x3ada, 0x3a57,
+         0x3958, 0x36d4, 0x364b, 0x35cf, 0x3556, 0x3463, 0x4ee0, 0x55cf,
+         0x5560, 0x5556, 0x54da, 0x605a, 0x5463, 0x6048, 0x603e, 0x603c},
+        {0x9162, 0x9162, 0x9162, 0x9162, 0x9162, 0x99a2, 0x9414, 0x92a5,
+         0x92a5, 0x7d52, 0x7d47, 0x7162, 0x7164, 0x7162, 0x78da, 0x7b2c,
+         0x79a2, 0x7414, 0x5b5c, 0x5d52, 0x51c2, 0x5162, 0x5162, 0x5162,
+         0x5162, 0x5162, 0x5162, 0x5162, 0x5162, 0x5162, 0x5162, 0x6c15,
+         0x6d9a, 0x6db0, 0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x91df, 0x91df, 0x91df, 0x91e2, 0x91e2, 0x99a2, 0x949e, 0x9422,
+         0x93a7, 0x7ce4, 0x7ccc, 0x7164, 0x7162, 0x71e2, 0x7bb4, 0x7b2d,
+         0x79a2, 0x5b5b, 0x6028, 0x5d52, 0x5247, 0x51df, 0x51df, 0x51df,
+         0x51df, 0x51df, 0x51df, 0x51df, 0x51df, 0x51df, 0x51df, 0x6c15,
+         0x6d9a, 0x6db0, 0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x925e, 0x925e, 0x925e, 0x9b3c, 0x9ab5, 0x99a3, 0x9526, 0x94aa,
+         0x942f, 0x7c62, 0x7be0, 0x7162, 0x7164, 0x7162, 0x7ac7, 0x7a42,
+         0x7936, 0x7414, 0x59e3, 0x5ce4, 0x52cb, 0x525e, 0x525e, 0x525e,
+         0x525e, 0x525e, 0x525e, 0x525e, 0x525e, 0x525e, 0x525e, 0x6c15,
+         0x6d9a, 0x6db0, 0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x92e2, 0x92e2, 0x92e2, 0x9b3b, 0x9ab5, 0x9933, 0x95ae, 0x94b8,
+         0x943c, 0x7cda, 0x7bde, 0x7164, 0x7162, 0x71e2, 0x7a58, 0x79d8,
+         0x7933, 0x749e, 0x7414, 0x5cda, 0x52e0, 0x52de, 0x52de, 0x52de,
+         0x52de, 0x52de, 0x52de, 0x52de, 0x52e2, 0x52e2, 0x52e2, 0x69e2,
+         0x6d9a, 0x6db0, 0x6db0, 0x6e38, 0x6e41, 0x6e41, 0x6ebf, 0x6ec9},
+        {0x9bdd, 0x9bd0, 0x9b4c, 0x9ac8, 0x9a44, 0x99bc, 0x9638, 0x8663,
+         0x8663, 0x7c62, 0x7bdd, 0x725e, 0x71e2, 0x7ad9, 0x7a57, 0x79d6,
+         0x6663, 0x6663, 0x6663, 0x6663, 0x5360, 0x5360, 0x5360, 0x5360,
+         0x5360, 0x5360, 0x5360, 0x53d4, 0x53d4, 0x53d4, 0x675c, 0x69e1,
+         0x72a6, 0x7230, 0x7230, 0x723c, 0x71c4, 0x71c2, 0x71c2, 0x71cd},
+        {0x9bd2, 0x9b4b, 0x9b4b, 0x84df, 0x855e, 0x855e, 0x8557, 0x85d2,
+         0x85d2, 0x7c62, 0x7bde, 0x72e2, 0x7ada, 0x7ad9, 0x6563, 0x6563,
+         0x65de, 0x665b, 0x665a, 0x5c62, 0x53d2, 0x535f, 0x535f, 0x535f,
+         0x535f, 0x535f, 0x535f, 0x535f, 0x53d2, 0x53d2, 0x6752, 0x69d6,
+         0x6a5a, 0x6ae2, 0x6ae3, 0x7345, 0x72bf, 0x7247, 0x7247, 0x72d8},
+        {0x9b5b, 0x9b56, 0x9b54, 0x84df, 0x84e0, 0x855c, 0x8557, 0x8558,
+         0x85d1, 0x7c62, 0x7bdd, 0x7b5b, 0x7ada, 0x6563, 0x64e0, 0x655c,
+         0x6558, 0x6558, 0x65d1, 0x664d, 0x53e1, 0x53e1, 0x53e1, 0x53e1,
+         0x53e1, 0x53e2, 0x5456, 0x5456, 0x5456, 0x53e1, 0x66d4, 0x69d6,
+         0x6a5a, 0x6ae2, 0x6ae3, 0x7350, 0x7346, 0x72cb, 0x72cb, 0x72e0},
+        {0x9b5b, 0x8357, 0x8357, 0x83ca, 0x8443, 0x8443, 0x8442, 0x84ba,
+         0x84ba, 0x7c62, 0x7bde, 0x645f, 0x645f, 0x645e, 0x64d3, 0x64d3,
+         0x654e, 0x6563, 0x6563, 0x635a, 0x53e2, 0x53e2, 0x53e2, 0x53e2,
+         0x53e2, 0x53e2, 0x5456, 0x5456, 0x5456, 0x5456, 0x66d4, 0x69ce,
+         0x6a4f, 0x6ad6, 0x6ae3, 0x7350, 0x6b63, 0x7352, 0x72e0, 0x72e0},
+        {0x82d5, 0x82ca, 0x82ca, 0x82c2, 0x8336, 0x8336, 0x8333, 0x83ab,
+         0x83ab, 0x7c62, 0x7bde, 0x7bde, 0x6460, 0x6460, 0x645c, 0x64d4,
+         0x64d4, 0x654c, 0x6563, 0x6253, 0x5464, 0x5464, 0x5464, 0x55d0,
+         0x5554, 0x5554, 0x54dc, 0x5464, 0x5464, 0x5464, 0x66d4, 0x69ce,
+         0x6a4f, 0x6ad6, 0x6ae3, 0x73d4, 0x6b63, 0x73db, 0x7360, 0x7360},
+    },
+    {
+        {0x6152, 0x6152, 0x6152, 0x6152, 0x6152, 0x6152, 0x4064, 0x4064,
+         0x405a, 0x405a, 0x4052, 0x4052, 0x4050, 0x4046, 0x4046, 0x403e,
+         0x403c, 0x4032, 0x402a, 0x4028, 0x401e, 0x4014, 0x4006, 0x23e2,
+         0x23e2, 0x23da, 0x23da, 0x2452, 0x244e, 0x244e, 0x23da, 0x244e,
+         0x245e, 0x24c6, 0x2542, 0x275c, 0x4046, 0x4046, 0x23e2, 0x23e2},
+        {0x603e, 0x603c, 0x6032, 0x602a, 0x6028, 0x601e, 0x4064, 0x4064,
+         0x5de3, 0x5de3, 0x5dda, 0x5dda, 0x5dd8, 0x5d52, 0x5d52, 0x5d47,
+         0x5d47, 0x5cc2, 0x5c3a, 0x5c3a, 0x5c2d, 0x5b2c, 0x59a2, 0x235a,
+         0x235a, 0x2357, 0x2357, 0x23ca, 0x23d9, 0x2443, 0x23ca, 0x23d9,
+         0x2442, 0x2442, 0x24ba, 0x2748, 0x4046, 0x2b5c, 0x235a, 0x235a},
+        {0x7164, 0x7164, 0x7162, 0x7bc2, 0x7bc2, 0x415e, 0x4064, 0x4064,
+         0x5de3, 0x5de3, 0x5d5e, 0x5d5e, 0x5ce4, 0x5cda, 0x5cd8, 0x5c56,
+         0x5c54, 0x5bcf, 0x5bc2, 0x5bc1, 0x5b3b, 0x5ab5, 0x5933, 0x235a,
+         0x235a, 0x2357, 0x2357, 0x2357, 0x2357, 0x23ca, 0x2346, 0x2357,
+         0x23ca, 0x2440, 0x2440, 0x27be, 0x2a4e, 0x2ae3, 0x235a, 0x235a},
+        {0x7164, 0x7164, 0x7162, 0x4064, 0x4064, 0x405a, 0x405a, 0x4052,
+         0x5de3, 0x5de3, 0x5d5e, 0x5d5e, 0x5ce4, 0x5c62, 0x5c61, 0x5bde,
+         0x5bdd, 0x5b5b, 0x5b4b, 0x5b4b, 0x22de, 0x22de, 0x22de, 0x22d6,
+         0x22d5, 0x22d5, 0x22d5, 0x22d5, 0x22d6, 0x2345, 0x2357, 0x22d6,
+         0x235a, 0x2358, 0x23ba, 0x2740, 0x22de, 0x22de, 0x22d6, 0x22d6},
+        {0x7164, 0x7164, 0x4064, 0x4064, 0x405a, 0x5e5f, 0x5de4, 0x5de4,
+         0x5de3, 0x5dd8, 0x5d5e, 0x5d54, 0x5ce4, 0x5c62, 0x5b62, 0x5ada,
+         0x5ada, 0x5a57, 0x4663, 0x2264, 0x225a, 0x225a, 0x2259, 0x2253,
+         0x21e0, 0x2253, 0x2253, 0x2253, 0x21d5, 0x2253, 0x22c0, 0x21d5,
+         0x21d2, 0x22ab, 0x22c2, 0x2264, 0x225a, 0x2259, 0x2253, 0x2253},
+        {0x6563, 0x4064, 0x4064, 0x405a, 0x5e5f, 0x5de3, 0x5de3, 0x5dda,
+         0x5dd8, 0x5d5d, 0x5d52, 0x5cd8, 0x5cd8, 0x5c62, 0x4563, 0x4563,
+         0x4563, 0x465b, 0x215e, 0x215e, 0x2153, 0x2153, 0x2153, 0x2152,
+         0x2152, 0x2152, 0x2152, 0x2152, 0x2152, 0x2152, 0x2152, 0x21b2,
+         0x2222, 0x215e, 0x215e, 0x215e, 0x2153, 0x2153, 0x2152, 0x2152},
+        {0x4064, 0x405a, 0x405a, 0x5e5f, 0x5de3, 0x5de3, 0x5dda, 0x5d5e,
+         0x5d5d, 0x5d52, 0x5cd8, 0x5cd8, 0x44df, 0x44df, 0x44df, 0x4357,
+         0x2064, 0x2064, 0x205a, 0x205a, 0x2052, 0x2052, 0x2050, 0x2046,
+         0x2046, 0x203e, 0x203c, 0x2032, 0x202a, 0x2028, 0x201e, 0x2014,
+         0x2006, 0x2002, 0x205a, 0x205a, 0x2052, 0x2050, 0x2046, 0x2046},
+        {0x645e, 0x5e5f, 0x5de4, 0x5de3, 0x5de3, 0x5dd8, 0x5d5e, 0x5d54,
+         0x445f, 0x445f, 0x445e, 0x445e, 0x425a, 0x445e, 0x445e, 0x445e,
+         0x445e, 0x43ca, 0x3e5f, 0x3de4, 0x3de4, 0x3de4, 0x3dd8, 0x3dce,
+         0x3d54, 0x245f, 0x245f, 0x3d3e, 0x245e, 0x24d3, 0x24e0, 0x2557,
+         0x25d1, 0x264d, 0x2764, 0x29e1, 0x2ad2, 0x2ae3, 0x2b52, 0x2bda},
+        {0x6357, 0x5de3, 0x5de3, 0x5dda, 0x5dda, 0x5d5d, 0x5d52, 0x5cd8,
+         0x435a, 0x435a, 0x4357, 0x4357, 0x4357, 0x4357, 0x4357, 0x4357,
+         0x4259, 0x42c2, 0x3de3, 0x3de3, 0x3dda, 0x3dda, 0x3d5d, 0x3d52,
+         0x3cd8, 0x3cd8, 0x2460, 0x245f, 0x245e, 0x245c, 0x245e, 0x254c,
+         0x25c6, 0x2644, 0x2945, 0x2a4d, 0x2ad0, 0x2ae2, 0x2bd8, 0x2bd8},
+        {0x6253, 0x6253, 0x6253, 0x5d5e, 0x4264, 0x425a, 0x425a, 0x4259,
+         0x405a, 0x4253, 0x4253, 0x4253, 0x4253, 0x4253, 0x4253, 0x4253,
+         0x4253, 0x4253, 0x4052, 0x402a, 0x3d5e, 0x3d5e, 0x3d5d, 0x23e2,
+         0x23e2, 0x23da, 0x23da, 0x23da, 0x20db, 0x3bc1, 0x244e, 0x2542,
+         0x25bb, 0x263a, 0x2945, 0x2a4d, 0x2ad0, 0x2b52, 0x23e2, 0x23e2},
+        {0x7b62, 0x7ada, 0x7ada, 0x79e3, 0x78de, 0x7a5e, 0x79d9, 0x78da,
+         0x76d3, 0x75dc, 0x733e, 0x755f, 0x755f, 0x755f, 0x755f, 0x755f,
+         0x755f, 0x5b62, 0x5ada, 0x5942, 0x533e, 0x59d6, 0x58da, 0x564b,
+         0x55cf, 0x5560, 0x5556, 0x54da, 0x54da, 0x5463, 0x3ada, 0x39d6,
+         0x38da, 0x364b, 0x3560, 0x34da, 0x3463, 0x4046, 0x403e, 0x403c},
+        {0x9162, 0x9162, 0x9162, 0x9162, 0x9162, 0x9162, 0x9162, 0x9162,
+         0x7b5c, 0x7d52, 0x7d47, 0x7162, 0x7162, 0x7162, 0x7c2d, 0x7b2c,
+         0x79a2, 0x7414, 0x5b5c, 0x6014, 0x71c2, 0x53d2, 0x6c15, 0x6d9a,
+         0x6e22, 0x6064, 0x6064, 0x605a, 0x5b5c, 0x5510, 0x51c2, 0x51c2,
+         0x51c2, 0x5164, 0x5162, 0x5162, 0x5162, 0x5162, 0x5162, 0x5162},
+        {0x9164, 0x9164, 0x9162, 0x91df, 0x91df, 0x91e2, 0x91e2, 0x7b5b,
+         0x8028, 0x7ce4, 0x7ccc, 0x7164, 0x7162, 0x71e2, 0x7bb4, 0x7b2d,
+         0x79a2, 0x5b5b, 0x6028, 0x601e, 0x7247, 0x7164, 0x53e2, 0x6c15,
+         0x6064, 0x6e22, 0x605a, 0x5b5b, 0x6028, 0x5621, 0x5247, 0x5247,
+         0x51df, 0x51df, 0x51df, 0x51df, 0x51df, 0x51df, 0x51df, 0x51df},
+        {0x9162, 0x9162, 0x9164, 0x9162, 0x925e, 0x9526, 0x94aa, 0x9414,
+         0x79e3, 0x7ce4, 0x7be0, 0x7162, 0x7164, 0x7162, 0x7ac7, 0x7a42,
+         0x7936, 0x7414, 0x72a5, 0x72a6, 0x7230, 0x7162, 0x7164, 0x7162,
+         0x71c2, 0x71c2, 0x71cd, 0x71ce, 0x71d7, 0x562c, 0x52cb, 0x52cb,
+         0x525e, 0x525e, 0x525e, 0x525e, 0x525e, 0x525e, 0x525e, 0x525e},
+        {0x9164, 0x9164, 0x9162, 0x91e2, 0x92e2, 0x95ae, 0x8663, 0x8663,
+         0x8663, 0x7cda, 0x7be0, 0x71df, 0x7b56, 0x71e2, 0x7a58, 0x79d8,
+         0x7933, 0x749e, 0x7422, 0x73a7, 0x72ba, 0x71df, 0x72ba, 0x71e2,
+         0x7247, 0x7247, 0x7252, 0x6663, 0x6663, 0x562c, 0x52e0, 0x52de,
+         0x52de, 0x52de, 0x52de, 0x52de, 0x52de, 0x52de, 0x52de, 0x52de},
+        {0x925e, 0x925e, 0x91e2, 0x9a44, 0x8563, 0x8563, 0x85de, 0x865b,
+         0x865a, 0x7ce4, 0x7bdd, 0x725e, 0x7ada, 0x7ad9, 0x7a57, 0x79d6,
+         0x7942, 0x7526, 0x74aa, 0x742f, 0x733e, 0x725e, 0x733e, 0x72cb,
+         0x6563, 0x6563, 0x65de, 0x665b, 0x665a, 0x56b4, 0x5360, 0x5360,
+         0x5360, 0x5360, 0x5360, 0x5360, 0x5360, 0x5360, 0x5360, 0x5360},
+        {0x92e2, 0x92e2, 0x935f, 0x84df, 0x855e, 0x855e, 0x8557, 0x85d2,
+         0x85d2, 0x7c62, 0x7bde, 0x72e2, 0x7ada, 0x7ad9, 0x7a57, 0x6663,
+         0x66df, 0x675e, 0x69e2, 0x743c, 0x6663, 0x66df, 0x675e, 0x64df,
+         0x655e, 0x655e, 0x6557, 0x65d2, 0x65d2, 0x56c0, 0x53d2, 0x535f,
+         0x535f, 0x535f, 0x535f, 0x535f, 0x535f, 0x535f, 0x535f, 0x535f},
+        {0x9b56, 0x845f, 0x845f, 0x845e, 0x84d3, 0x84d3, 0x854e, 0x8558,
+         0x85c6, 0x8642, 0x7bdd, 0x7b5b, 0x7ada, 0x7b4b, 0x7a57, 0x6664,
+         0x6663, 0x66df, 0x675e, 0x6663, 0x6664, 0x645f, 0x645f, 0x645e,
+         0x64d3, 0x64d3, 0x654e, 0x6558, 0x65c6, 0x56c0, 0x53e1, 0x53e1,
+         0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1, 0x53e1},
+        {0x9b56, 0x845f, 0x845f, 0x845e, 0x845c, 0x84d3, 0x84d4, 0x854c,
+         0x8563, 0x835a, 0x7bde, 0x7b5b, 0x6563, 0x7ad9, 0x65de, 0x665b,
+         0x665a, 0x6563, 0x6563, 0x635a, 0x635c, 0x6357, 0x6357, 0x6358,
+         0x63cc, 0x6443, 0x6440, 0x6440, 0x64b9, 0x56c9, 0x53e2, 0x53e2,
+         0x53e2, 0x53e2, 0x53e2, 0x53e2, 0x53e2, 0x53e2, 0x53e2, 0x53e2},
+        {0x9b61, 0x83da, 0x83da, 0x8452, 0x844e, 0x844e, 0x84c6, 0x8542,
+         0x8542, 0x8253, 0x7bde, 0x8253, 0x7b5b, 0x7ad9, 0x7a58, 0x79d8,
+         0x78da, 0x7641, 0x7548, 0x6253, 0x6254, 0x6254, 0x62c8, 0x62c2,
+         0x62c0, 0x6335, 0x6333, 0x6334, 0x63ab, 0x56c9, 0x5464, 0x5464,
+         0x5464, 0x5464, 0x5464, 0x5464, 0x5464, 0x5464, 0x5464, 0x5464},
+        {0x9ada, 0x9ada, 0x9a57, 0x99d6, 0x994a, 0x964b, 0x95cf, 0x95cf,
+         0x9556, 0x94da, 0x9463, 0x7b62, 0x7ada, 0x7ada, 0x7a57, 0x79d6,
+         0x78da, 0x764b, 0x75cf, 0x75cf, 0x7463, 0x7463, 0x7463, 0x7463,
+         0x7463, 0x7463, 0x7463, 0x7463, 0x7463, 0x57c7, 0x5463, 0x5463,
+         0x5463, 0x5463, 0x5463, 0x5463, 0x5463, 0x5463, 0x5463, 0x5463},
+        {0xb162, 0xb162, 0xb162, 0xb162, 0xb162, 0xb162, 0xb162, 0xb162,
+         0xb162, 0x9d52, 0x91c2, 0x9162, 0x9162, 0x9162, 0x9162, 0x9162,
+         0x9162, 0x9162, 0x9162, 0x7d52, 0x7d54, 0x7d47, 0x7d47, 0x7cc2,
+         0x7c3a, 0x7c3a, 0x7c2d, 0x7b2c, 0x79a2, 0x7414, 0x71c2, 0x7162,
+         0x7162, 0x7162, 0x7162, 0x7162, 0x7162, 0x7162, 0x7162, 0x7162},
+        {0xb1df, 0xb1df, 0xb1df, 0xb1df, 0xb1df, 0xb1df, 0xb1df, 0xb1df,
+         0xb1df, 0x9d52, 0x9247, 0x91df, 0x91df, 0x91df, 0x91df, 0x91df,
+         0x91df, 0x91df, 0x91df, 0x7d52, 0x7cd8, 0x7cd8, 0x7ccc, 0x7cc2,
+         0x7c3a, 0x7bc1, 0x7bb4, 0x7b2d, 0x79a2, 0x749e, 0x7247, 0x71df,
+         0x71df, 0x71df, 0x71df, 0x71df, 0x71df, 0x71df, 0x71df, 0x71df},
+        {0xb25e, 0xb25e, 0xb25e, 0xb25e, 0xb25e, 0xb25e, 0xb25e, 0xb25e,
+         0xb25e, 0x9c62, 0x92cb, 0x925e, 0x925e, 0x925e, 0x925e, 0x925e,
+         0x925e, 0x925e, 0x925e, 0x7d5a, 0x7cd9, 0x7cce, 0x7c54, 0x7c47,
+         0x7c3e, 0x7bc4, 0x7b3c, 0x7ab5, 0x79a3, 0x7526, 0x72cb, 0x725e,
+         0x725e, 0x725e, 0x725e, 0x725e, 0x725e, 0x725e, 0x725e, 0x725e},
+        {0xb2de, 0xb2de, 0xb2de, 0xb2de, 0xb2de, 0xb2de, 0xb2de, 0xb2de,
+         0xb2de, 0x9c62, 0x92e0, 0x92de, 0x92de, 0x92de, 0x92de, 0x92de,
+         0x92de, 0x92de, 0x92de, 0x7cda, 0x7cd9, 0x7c56, 0x7c54, 0x7bcf,
+         0x7bc2, 0x7bc2, 0x7b3b, 0x7ab5, 0x7933, 0x75ae, 0x72e0, 0x72de,
+         0x72de, 0x72de, 0x72de, 0x72de, 0x72de, 0x72de, 0x72de, 0x72de},
+        {0xb360, 0xb360, 0xb360, 0xb360, 0xb360, 0xb360, 0xb360, 0xa663,
+         0xa663, 0x9c62, 0x9360, 0x9360, 0x9360, 0x9360, 0x9360, 0x9360,
+         0x9360, 0x8663, 0x8663, 0x86df, 0x7c61, 0x7c61, 0x7bdd, 0x7bdd,
+         0x7bd0, 0x7b4c, 0x7ac8, 0x7a44, 0x79bc, 0x7638, 0x7360, 0x7360,
+         0x7360, 0x7360, 0x7360, 0x7360, 0x7360, 0x7360, 0x7360, 0x7360},
+        {0xb35f, 0xb35f, 0xb35f, 0xa4df, 0xa55e, 0xa55e, 0xa557, 0xa5d2,
+         0xa5d2, 0x9c62, 0x93d2, 0x935f, 0x935f, 0x935f, 0x8563, 0x8563,
+         0x85de, 0x865b, 0x865a, 0x7c62, 0x84df, 0x7c5b, 0x7be0, 0x7bd2,
+         0x7b4b, 0x7b4b, 0x7ac7, 0x7a42, 0x7936, 0x7636, 0x73d2, 0x735f,
+         0x735f, 0x735f, 0x735f, 0x735f, 0x735f, 0x735f, 0x735f, 0x735f},
+        {0xb3e1, 0xb3e1, 0xb3e1, 0xa4df, 0xa4e0, 0xa55c, 0xa557, 0xa558,
+         0xa5d1, 0x9c62, 0x93e1, 0x93e1, 0x93e1, 0x93e1, 0x84e0, 0x855c,
+         0x8558, 0x8558, 0x85d1, 0x864d, 0x84df, 0x7bde, 0x7bde, 0x7b5b,
+         0x7b56, 0x7b54, 0x7acd, 0x7a47, 0x7942, 0x7641, 0x73e1, 0x73e1,
+         0x73e1, 0x73e1, 0x73e1, 0x73e1, 0x73e1, 0x73e1, 0x73e1, 0x73e1},
+        {0xb3e2, 0xa357, 0xa357, 0xa3ca, 0xa443, 0xa443, 0xa442, 0xa4ba,
+         0xa4ba, 0x9c62, 0x93e2, 0x845f, 0x845f, 0x845e, 0x84d3, 0x84d3,
+         0x854e, 0x85c6, 0x85c6, 0x835a, 0x8357, 0x7bde, 0x7bde, 0x7b5b,
+         0x7b56, 0x7ad9, 0x7a58, 0x79d8, 0x7942, 0x7642, 0x73e2, 0x73e2,
+         0x73e2, 0x73e2, 0x73e2, 0x73e2, 0x73e2, 0x73e2, 0x73e2, 0x73e2},
+        {0xa2d5, 0xa2ca, 0xa2ca, 0xa2c2, 0xa336, 0xa336, 0xa333, 0xa3ab,
+         0xa3ab, 0x9c62, 0x9464, 0x9464, 0x8460, 0x8460, 0x845c, 0x84d4,
+         0x84d4, 0x854c, 0x85c8, 0x8253, 0x8253, 0x8253, 0x8253, 0x8253,
+         0x7b61, 0x7ad9, 0x7a58, 0x79d8, 0x79d0, 0x764c, 0x7464, 0x7464,
+         0x7464, 0x7464, 0x7464, 0x7464, 0x7464, 0x7464, 0x7464, 0x7464},
+    },
+};
@@ -0,0 +1,339 @@
+/* Asset packer
+ *
+ * Build: gcc -O2 -no-pie -o asset_packer tools/asset_packer.c -lm
+ * Usage: asset_packer [-r rate] assets/assets.bin assets/score.wav@32000 \
+ *            assets/finish.ppm ...
+ *        asset_packer -t > audio_taps.h
+ *
+ * Packs sounds and images into the AssetPack the game links in (or has
+ * loaded at ASSET_PACK_ADDR), in the order given. Each asset is named after
+ * its file without directory and extension:
+ *
+ *   .wav   mono PCM, 16 or 32 bits, stored as ASSET_PCM16; the sample rate
+ *          goes in info. With -r, clips at a higher rate are low-pass
+ *          filtered and resampled to that rate first, the game
+ *          interpolates them back up to AUDIO_RATE while playing. A rate
+ *          after the file name (file.wav@32000) overrides -r for that clip,
+ *          @0 keeps it at its own rate: pick one whose cut-off (0.45 of
+ *          it) is above the clip's loudest tones. AUDIO_TAPS / 2 zero
+ *          samples go before and after the clip for the game's filter.
+ *   .ppm   binary PPM (P6, maxval 255), stored as ASSET_RGB565
+ *
+ * -t writes the game's interpolation filter table instead. */
+#define HOST_BUILD
+#define GOLF_NO_MAIN
+#define GOLF_NO_ASSETS
+#include "../golf.c"
+
+#define MAX_ASSETS 64
+#define MAX_PATH 256
+#define RESAMPLE_TAPS 16  // Filter half-width, in output samples
+#define TAPS_BETA 6.0     // Kaiser window of the game's filter
+
+/* Read a whole file, NULL on failure */
+static uint8_t *read_file(const char *path, long *size) {
+  FILE *file = fopen(path, "rb");
+  if (!file) return NULL;
+  fseek(file, 0, SEEK_END);
+  *size = ftell(file);
+  fseek(file, 0, SEEK_SET);
+  uint8_t *data = malloc(*size > 0 ? *size : 1);
+  if (fread(data, 1, *size, file) != (size_t)*size) {
+    free(data);
+    data = NULL;
+  }
+  fclose(file);
+  return data;
+}
+
+static uint32_t le32(const uint8_t *p) {
+  return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t)p[3] << 24;
+}
+
+static uint16_t le16(const uint8_t *p) { return p[0] | p[1] << 8; }
+
+/* WAV file to 32-bit samples; returns the sample count, -1 if unsupported */
+static int convert_wav(const uint8_t *data, long size, int32_t **samples,
+                       uint32_t *rate) {
+  if (size < 12 || memcmp(data, "RIFF", 4) || memcmp(data + 8, "WAVE", 4))
+    return -1;
+
+  int bits = 0;
+  for (long at = 12; at + 8 <= size;) {
+    uint32_t length = le32(data + at + 4);
+    const uint8_t *chunk = data + at + 8;
+    if (at + 8 + (long)length > size) return -1;
+
+    if (!memcmp(data + at, "fmt ", 4) && length >= 16) {
+      if (le16(chunk) != 1 || le16(chunk + 2) != 1) return -1;  // Mono PCM
+      *rate = le32(chunk + 4);
+      bits = le16(chunk + 14);
+    } else if (!memcmp(data + at, "data", 4)) {
+      if (bits != 16 && bits != 32) return -1;
+      int count = length / (bits / 8);
+      *samples = malloc(count * sizeof(int32_t) + 1);
+      for (int i = 0; i < count; i++) {
+        if (bits == 16) {
+          int16_t sample = le16(chunk + 2 * i);
+          (*samples)[i] = (int32_t)((uint32_t)sample << 16);
+        } else {
+          (*samples)[i] = (int32_t)le32(chunk + 4 * i);
+        }
+      }
+      return count;
+    }
+    at += 8 + length + (length & 1);
+  }
+  return -1;
+}
+
+/* Windowed-sinc resampling to a lower rate, cut off just below the new
+ * Nyquist frequency; returns the new sample count */
+static int resample(const int32_t *in, int count, uint32_t from, uint32_t to,
+                    int32_t **out) {
+  double ratio = (double)from / to;  // Input samples per output sample
+  double cutoff = 0.45 / ratio;      // Cycles per input sample
+  double reach = RESAMPLE_TAPS * ratio;
+  int out_count = (int)((double)count * to / from);
+
+  *out = malloc(out_count * sizeof(int32_t) + 1);
+  for (int j = 0; j < out_count; j++) {
+    double center = j * ratio, sum = 0, weight = 0;
+    int first = (int)ceil(center - reach), last = (int)floor(center + reach);
+    for (int k = first; k <= last; k++) {
+      double t = k - center;
+      double sinc = t == 0 ? 1 : sin(2 * M_PI * cutoff * t) /
+                                     (2 * M_PI * cutoff * t);
+      double window = 0.5 + 0.5 * cos(M_PI * t / reach);
+      double tap = sinc * window;
+      if (k >= 0 && k < count) sum += tap * in[k];
+      weight += tap;
+    }
+    double sample = sum / weight;
+    if (sample > INT32_MAX) sample = INT32_MAX;
+    if (sample < INT32_MIN) sample = INT32_MIN;
+    (*out)[j] = (int32_t)lrint(sample);
+  }
+  return out_count;
+}
+
+/* Top 16 bits of each sample, rounded, with AUDIO_TAPS / 2 zero samples
+ * at each end */
+static int16_t *to_pcm16(const int32_t *samples, int count) {
+  int16_t *pcm = calloc(count + AUDIO_TAPS, sizeof(int16_t));
+  for (int i = 0; i < count; i++) {
+    int64_t sample = ((int64_t)samples[i] + 0x8000) >> 16;
+    pcm[AUDIO_TAPS / 2 + i] = sample > INT16_MAX ? INT16_MAX : sample;
+  }
+  return pcm;
+}
+
+/* Modified Bessel function I0, for the Kaiser window */
+static double bessel_i0(double x) {
+  double sum = 1, term = 1;
+  for (int k = 1; k < 32; k++) {
+    term *= x / (2 * k);
+    sum += term * term;
+  }
+  return sum;
+}
+
+/* Print audio_taps.h: for each phase, a windowed sinc centred p /
+ * AUDIO_PHASES after sample AUDIO_TAPS / 2 - 1, scaled to sum to 1 in Q14.
+ * The cut-off is the clip's Nyquist frequency, the pack filtered the clip
+ * below it. */
+static void write_taps() {
+  printf("/* Generated by tools/asset_packer -t, do not edit.\n");
+  printf(" * Polyphase interpolation filter for audio_irq(). */\n");
+  printf("static const int16_t audio_taps[AUDIO_PHASES + 1][AUDIO_TAPS]\n");
+  printf("    ONCHIP_RODATA = {\n");
+  for (int p = 0; p <= AUDIO_PHASES; p++) {
+    double taps[AUDIO_TAPS], sum = 0;
+    for (int k = 0; k < AUDIO_TAPS; k++) {
+      double t = k - (AUDIO_TAPS / 2 - 1) - (double)p / AUDIO_PHASES;
+      double a = t / (AUDIO_TAPS / 2);
+      double sinc = t == 0 ? 1 : sin(M_PI * t) / (M_PI * t);
+      double window =
+          a * a >= 1 ? 0 : bessel_i0(TAPS_BETA * sqrt(1 - a * a)) /
+                               bessel_i0(TAPS_BETA);
+      taps[k] = sinc * window;
+      sum += taps[k];
+    }
+
+    // Round, then put what rounding lost on the centre tap
+    int q14[AUDIO_TAPS], total = 0, centre = AUDIO_TAPS / 2 - 1;
+    for (int k = 0; k < AUDIO_TAPS; k++) {
+      q14[k] = (int)lrint(taps[k] / sum * 16384);
+      total += q14[k];
+      if (fabs(taps[k]) > fabs(taps[centre])) centre = k;
+    }
+    q14[centre] += 16384 - total;
+
+    for (int k = 0; k < AUDIO_TAPS; k++) {
+      printf("%s%6d%s", k % 8 ? "" : k ? "\n     " : "    {", q14[k],
+             k < AUDIO_TAPS - 1 ? "," : p < AUDIO_PHASES ? "},\n" : "}};\n");
+    }
+  }
+}
+
+/* Skip whitespace and comments in a PPM header */
+static long ppm_skip(const uint8_t *data, long size, long at) {
+  while (at < size) {
+    if (data[at] == '#') {
+      while (at < size && data[at] != '\n') at++;
+    } else if (data[at] == ' ' || data[at] == '\t' || data[at] == '\r' ||
+               data[at] == '\n') {
+      at++;
+    } else {
+      break;
+    }
+  }
+  return at;
+}
+
+static long ppm_number(const uint8_t *data, long size, long at, int *value) {
+  at = ppm_skip(data, size, at);
+  *value = 0;
+  while (at < size && data[at] >= '0' && data[at] <= '9') {
+    *value = *value * 10 + data[at++] - '0';
+  }
+  return at;
+}
+
+/* Binary PPM to RGB565; returns the pixel count, -1 if unsupported */
+static int convert_ppm(const uint8_t *data, long size, uint16_t **pixels,
+                       int *width, int *height) {
+  int maxval;
+  if (size < 2 || data[0] != 'P' || data[1] != '6') return -1;
+  long at = ppm_number(data, size, 2, width);
+  at = ppm_number(data, size, at, height);
+  at = ppm_number(data, size, at, &maxval) + 1;  // One whitespace byte
+  int count = *width * *height;
+  if (maxval != 255 || count <= 0 || at + 3L * count > size) return -1;
+
+  *pixels = malloc(count * sizeof(uint16_t));
+  for (int i = 0; i < count; i++) {
+    const uint8_t *rgb = data + at + 3 * i;
+    (*pixels)[i] = (rgb[0] >> 3) << 11 | (rgb[1] >> 2) << 5 | rgb[2] >> 3;
+  }
+  return count;
+}
+
+/* Asset name: file name without directory and extension */
+static int asset_name(const char *path, char *name) {
+  const char *base = strrchr(path, '/');
+  base = base ? base + 1 : path;
+  const char *dot = strrchr(base, '.');
+  int length = dot ? dot - base : (int)strlen(base);
+  if (length == 0 || length >= ASSET_NAME_SIZE) return -1;
+  memset(name, 0, ASSET_NAME_SIZE);
+  memcpy(name, base, length);
+  return 0;
+}
+
+int main(int argc, char **argv) {
+  static AssetEntry entries[MAX_ASSETS];
+  static void *payloads[MAX_ASSETS];
+  uint32_t max_rate = 0;  // 0 keeps every clip at its own rate
+
+  if (argc == 2 && !strcmp(argv[1], "-t")) {
+    write_taps();
+    return 0;
+  }
+  if (argc > 2 && !strcmp(argv[1], "-r")) {
+    max_rate = atoi(argv[2]);
+    argc -= 2;
+    argv += 2;
+  }
+
+  int count = argc - 2;
+  if (argc < 3 || count > MAX_ASSETS) {
+    fprintf(stderr,
+            "usage: %s [-r rate] pack.bin file.wav[@rate]|file.ppm...\n"
+            "       %s -t > audio_taps.h\n",
+            argv[0], argv[0]);
+    return 1;
+  }
+
+  uint32_t offset = sizeof(AssetPack) + count * sizeof(AssetEntry);
+  for (int i = 0; i < count; i++) {
+    char path[MAX_PATH];
+    AssetEntry *entry = &entries[i];
+    uint32_t rate = max_rate;
+
+    // file.wav@rate: this clip's own limit
+    snprintf(path, sizeof(path), "%s", argv[i + 2]);
+    char *at = strrchr(path, '@');
+    if (at) {
+      *at = '\0';
+      rate = atoi(at + 1);
+    }
+    const char *ext = strrchr(path, '.');
+    long size;
+    uint8_t *data = read_file(path, &size);
+
+    if (!data || asset_name(path, entry->name) || !ext) {
+      fprintf(stderr, "%s: cannot read or bad name\n", path);
+      return 1;
+    }
+
+    int converted = -1;
+    if (!strcmp(ext, ".wav")) {
+      int32_t *samples;
+      converted = convert_wav(data, size, &samples, &entry->info);
+      if (converted >= 0) {
+        if (rate && entry->info > rate) {
+          int32_t *resampled;
+          converted =
+              resample(samples, converted, entry->info, rate, &resampled);
+          free(samples);
+          samples = resampled;
+          entry->info = rate;
+        }
+        payloads[i] = to_pcm16(samples, converted);
+        free(samples);
+      }
+      entry->format = ASSET_PCM16;
+      entry->length = (converted + AUDIO_TAPS) * sizeof(int16_t);
+    } else if (!strcmp(ext, ".ppm")) {
+      int width = 0, height = 0;
+      converted = convert_ppm(data, size, (uint16_t **)&payloads[i], &width,
+                              &height);
+      entry->format = ASSET_RGB565;
+      entry->info = width << 16 | height;
+      entry->length = converted * sizeof(uint16_t);
+    }
+    free(data);
+    if (converted < 0) {
+      fprintf(stderr, "%s: unsupported format\n", path);
+      return 1;
+    }
+
+    entry->offset = offset;
+    offset += (entry->length + 3) & ~3;
+    if (entry->format == ASSET_PCM16) {
+      fprintf(stderr, "%s: pcm16 at %u Hz, %u bytes\n", entry->name,
+              entry->info, entry->length);
+    } else {
+      fprintf(stderr, "%s: rgb565, %u bytes\n", entry->name, entry->length);
+    }
+  }
+
+  FILE *out = fopen(argv[1], "wb");
+  if (!out) {
+    fprintf(stderr, "%s: cannot write\n", argv[1]);
+    return 1;
+  }
+
+  AssetPack header = {ASSET_MAGIC, count};
+  fwrite(&header, sizeof(header), 1, out);
+  fwrite(entries, sizeof(AssetEntry), count, out);
+  for (int i = 0; i < count; i++) {
+    static const uint8_t pad[3];
+    fwrite(payloads[i], 1, entries[i].length, out);
+    fwrite(pad, 1, -entries[i].length & 3, out);
+  }
+  fclose(out);
+  fprintf(stderr, "%s: %d assets, %u bytes\n", argv[1], count, offset);
+  return 0;
+}
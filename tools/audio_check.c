@@ -0,0 +1,83 @@
+/* Audio FIFO statistics check
+ *
+ * Build: gcc -O2 -no-pie -o audio_check tools/audio_check.c -lm
+ * Usage: audio_check
+ *
+ * Runs audio_irq() against a model of the codec's write FIFO: one sample
+ * played per step, the write interrupt raised at AUDIO_WI_SPACE free.
+ * Starting a clip or a synthesizer voice from idle must not show up as an
+ * underrun or a late refill; a refill that really comes late must. Exits
+ * with 1 if a case fails. */
+#define HOST_BUILD
+#define GOLF_NO_MAIN
+#define GOLF_NO_ASSETS
+#include "../golf.c"
+
+int queued;  // Samples in the modelled FIFO
+
+/* Play steps samples, refilling when the interrupt is up unless the
+ * refill is held back for the first delay steps */
+void play(int steps, int delay) {
+  for (int step = 0; step < steps; step++) {
+    if (queued > 0) queued--;
+
+    unsigned int space = AUDIO_FIFO_SIZE - queued;
+    if ((audiop->control & 0x2) && space >= AUDIO_WI_SPACE && step >= delay) {
+      audiop->warc = space;
+      audiop->walc = space;
+      unsigned int before = audio_stats.samples;
+      audio_irq();
+      queued += audio_stats.samples - before;
+    }
+  }
+}
+
+int check(const char *name, unsigned int underruns, unsigned int late,
+          unsigned int low_water) {
+  AudioStats stats;
+  audio_stats_read(&stats);
+  bool ok = stats.underruns == underruns && stats.worst_late == late &&
+            stats.low_water >= low_water;
+  printf("%-28s %4u refills, low water %3u, worst %3u late, %u underruns %s\n",
+         name, stats.refills, stats.low_water, stats.worst_late,
+         stats.underruns, ok ? "ok" : "FAILED");
+  return ok ? 0 : 1;
+}
+
+int main() {
+  static int16_t samples[16000];
+  for (int i = 0; i < 16000; i++) samples[i] = (i % 40) * 400 - 8000;
+  Clip clip = {samples, 16000, 16000};
+  int failed = 0;
+
+  // A clip from idle, then restarted part way: the FIFO is cleared
+  audio_stats_reset();
+  audio_playback_mono(&clip);
+  queued = 0;
+  play(20000, 0);
+  audio_playback_mono(&clip);
+  queued = 0;
+  play(60000, 0);
+  failed |= check("clip start and restart", 0, 0,
+                  AUDIO_FIFO_SIZE - AUDIO_WI_SPACE);
+
+  // Synthesizer voices from idle, and one while another sounds
+  audio_stats_reset();
+  sound_tick();
+  play(5000, 0);
+  sound_bounce(5);
+  play(100, 0);
+  sound_tick();
+  play(5000, 0);
+  failed |= check("voices from idle", 0, 0, AUDIO_FIFO_SIZE - AUDIO_WI_SPACE);
+
+  // A refill held back until the FIFO ran dry
+  audio_stats_reset();
+  audio_playback_mono(&clip);
+  queued = 0;
+  play(1000, 0);
+  play(1000, 200);
+  failed |= check("late refill", 1, AUDIO_FIFO_SIZE - AUDIO_WI_SPACE, 0);
+
+  return failed;
+}
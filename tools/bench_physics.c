@@ -0,0 +1,107 @@
+/* Headless physics benchmark
+ *
+ * Build: gcc -O2 -no-pie -o bench_physics tools/bench_physics.c -lm
+ * Usage: bench_physics [rounds] [batch]
+ *
+ * Shoots every angle step (0.1 rad, like the arrow keys) at every momentum
+ * (1-100) on each course and runs step_ball() until the ball stops or is
+ * holed. With a batch size the shots are launched batch at a time into one
+ * BallSet and stepped together with step_balls() instead; the checksum is
+ * the same either way. Tests per step are the walls check_wall_collision()
+ * tested. No rendering and no MMIO are involved. */
+#define HOST_BUILD
+#define GOLF_NO_MAIN
+#include "../golf.c"
+
+#define ANGLE_STEPS 63  // 0.0 to 6.2 in 0.1 steps
+#define SHOTS (ANGLE_STEPS * 100)
+
+double now_seconds() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+/* Run the shots of one round batch balls at a time, returns the steps */
+long run_batched(BallSet *set, int batch, long *checksum) {
+  static uint8_t results[SHOTS];
+  long steps = 0;
+
+  for (int shot = 0; shot < SHOTS; shot += batch) {
+    set->count = SHOTS - shot < batch ? SHOTS - shot : batch;
+    for (int i = 0; i < set->count; i++) {
+      launch_set_ball(set, i, player_x, player_y, (shot + i) % 100 + 1,
+                      (shot + i) / 100 * 0.1);
+    }
+
+    int rolling;
+    do {
+      rolling = step_balls(set, course, results);
+      for (int i = 0; i < set->count; i++) {
+        if (results[i] != BALL_IDLE) steps++;
+      }
+    } while (rolling > 0);
+
+    for (int i = 0; i < set->count; i++) {
+      *checksum += set->x[i] * 31 + set->y[i];
+    }
+  }
+  return steps;
+}
+
+int main(int argc, char **argv) {
+  int rounds = argc > 1 ? atoi(argv[1]) : 20;
+  int batch = argc > 2 ? atoi(argv[2]) : 0;
+  long checksum = 0;
+
+  static int data[6][SHOTS];
+  BallSet set = {.x = data[0],
+                 .y = data[1],
+                 .vx = data[2],
+                 .vy = data[3],
+                 .momentum = data[4],
+                 .active = data[5],
+                 .sweep = NULL};
+  if (batch > SHOTS) batch = SHOTS;
+
+  printf("course  shots     steps  steps/s    ns/step  tests/step\n");
+
+  for (int id = 0; id < COURSE_COUNT; id++) {
+    load_course(id);
+
+    long shots = 0, steps = 0;
+    host_wall_tests = 0;
+    double start = now_seconds();
+
+    for (int round = 0; round < rounds; round++) {
+      if (batch > 0) {
+        steps += run_batched(&set, batch, &checksum);
+        shots += SHOTS;
+        continue;
+      }
+
+      for (int a = 0; a < ANGLE_STEPS; a++) {
+        for (int momentum = 1; momentum <= 100; momentum++) {
+          Ball ball = {.radius = BALL_SIZE};
+          launch_ball(&ball, player_x, player_y, momentum, a * 0.1);
+          shots++;
+
+          while (1) {
+            int result = step_ball(&ball, course);
+            steps++;
+            if (result != BALL_ROLLING) break;
+          }
+          checksum += ball.x * 31 + ball.y;
+        }
+      }
+    }
+
+    double seconds = now_seconds() - start;
+    printf("%6d %6ld %9ld %8.3g %10.2f %11.2f\n", id, shots, steps,
+           steps / seconds, seconds * 1e9 / steps,
+           (double)host_wall_tests / steps);
+  }
+
+  printf("checksum %ld\n", checksum);
+  return 0;
+}
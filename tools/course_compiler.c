@@ -0,0 +1,330 @@
+/* Course compiler
+ *
+ * Build: gcc -O2 -no-pie -o course_compiler tools/course_compiler.c -lm
+ * Usage: course_compiler courses/course0.txt courses/course1.txt ... \
+ *            > course_pack.h
+ *
+ * Turns text course descriptions into the packed CourseBlob the game maps
+ * in with map_course(), in the order given. A description is one item per
+ * line, '#' starts a comment:
+ *
+ *   start <x> <y>
+ *   goal <x> <y>
+ *   wall <x0> <y0> <x1> <y1>    (any angle, tested in order)
+ *
+ * The blob carries the walls' bounding box, a GRID_COLS x GRID_ROWS grid
+ * with a copy of every wall that can be hit from each cell, stored as
+ * structure-of-arrays (start, normal, length), and the walls and goal
+ * rasterized with the game's own draw_line() into clipped pixel runs for
+ * draw_course(). */
+#define HOST_BUILD
+#define GOLF_NO_MAIN
+#define GOLF_NO_COURSE_PACK
+#include "../golf.c"
+
+#define MAX_WALLS 255
+#define MAX_SPANS 2048
+#define BLOB_WORDS (1 << 14)  // Offsets are 16 bits
+
+/* Parsed course description */
+typedef struct {
+  int start_x, start_y;
+  int goal_x, goal_y;
+  int line_count;
+  Line lines[MAX_WALLS];
+} CourseSource;
+
+/* Append the runs of non-black pixels found inside a box of the frame */
+static int collect_spans(Span *spans, int count, int min_x, int min_y,
+                         int max_x, int max_y, bool vertical) {
+  int outer0 = vertical ? min_x : min_y, outer1 = vertical ? max_x : max_y;
+  int inner0 = vertical ? min_y : min_x, inner1 = vertical ? max_y : max_x;
+
+  for (int o = outer0; o <= outer1; o++) {
+    int run = -1;
+    for (int i = inner0; i <= inner1 + 1; i++) {
+      bool set = i <= inner1 &&
+                 (vertical ? frame[i][o] : frame[o][i]) != COLOR_BLACK;
+      if (set && run < 0) run = i;
+      if (!set && run >= 0) {
+        if (count == MAX_SPANS) return -1;
+        spans[count].x = vertical ? o : run;
+        spans[count].y = vertical ? run : o;
+        spans[count].length = i - run;
+        spans[count].vertical = vertical;
+        spans[count].color = vertical ? frame[run][o] : frame[o][run];
+        count++;
+        run = -1;
+      }
+    }
+  }
+  return count;
+}
+
+/* Rasterize the walls and the goal into clipped runs */
+static int rasterize_course(const CourseSource *src, Span *spans) {
+  int count = 0;
+
+  for (int i = 0; i < src->line_count && count >= 0; i++) {
+    const Line *line = &src->lines[i];
+    int min_x = line->x0 < line->x1 ? line->x0 : line->x1;
+    int max_x = line->x0 < line->x1 ? line->x1 : line->x0;
+    int min_y = line->y0 < line->y1 ? line->y0 : line->y1;
+    int max_y = line->y0 < line->y1 ? line->y1 : line->y0;
+    if (min_x < 0) min_x = 0;
+    if (max_x >= SCREEN_WIDTH) max_x = SCREEN_WIDTH - 1;
+    if (min_y < 0) min_y = 0;
+    if (max_y >= SCREEN_HEIGHT) max_y = SCREEN_HEIGHT - 1;
+
+    clear_screen();
+    draw_line(line->x0, line->y0, line->x1, line->y1, COLOR_WHITE);
+    count = collect_spans(spans, count, min_x, min_y, max_x, max_y,
+                          max_y - min_y > max_x - min_x);
+  }
+
+  // The goal is a 10x10 square drawn over the walls
+  int min_x = src->goal_x - 5, max_x = src->goal_x + 4;
+  int min_y = src->goal_y - 5, max_y = src->goal_y + 4;
+  if (min_x < 0) min_x = 0;
+  if (max_x >= SCREEN_WIDTH) max_x = SCREEN_WIDTH - 1;
+  if (min_y < 0) min_y = 0;
+  if (max_y >= SCREEN_HEIGHT) max_y = SCREEN_HEIGHT - 1;
+
+  clear_screen();
+  for (int y = min_y; y <= max_y && count >= 0; y++) {
+    memset(&frame[y][min_x], COLOR_GOAL, max_x - min_x + 1);
+  }
+  if (count >= 0 && min_x <= max_x) {
+    count = collect_spans(spans, count, min_x, min_y, max_x, max_y, false);
+  }
+  return count;
+}
+
+/* Whether a ball centered anywhere in a grid cell can touch a wall, with
+ * GRID_SLACK left for the pushes of walls tested before it */
+static bool wall_in_cell(const Line *line, int col, int row) {
+  int reach = BALL_SIZE + 1 + GRID_SLACK;
+  int min_x = (line->x0 < line->x1 ? line->x0 : line->x1) - reach;
+  int max_x = (line->x0 < line->x1 ? line->x1 : line->x0) + reach;
+  int min_y = (line->y0 < line->y1 ? line->y0 : line->y1) - reach;
+  int max_y = (line->y0 < line->y1 ? line->y1 : line->y0) + reach;
+  int cell_x = col << GRID_SHIFT, cell_y = row << GRID_SHIFT;
+
+  // The edge cells also take every position beyond the screen
+  int cell_x0 = col == 0 ? -32768 : cell_x;
+  int cell_x1 = col == GRID_COLS - 1 ? 32767 : cell_x + (1 << GRID_SHIFT) - 1;
+  int cell_y0 = row == 0 ? -32768 : cell_y;
+  int cell_y1 = row == GRID_ROWS - 1 ? 32767 : cell_y + (1 << GRID_SHIFT) - 1;
+
+  return max_x >= cell_x0 && min_x <= cell_x1 && max_y >= cell_y0 &&
+         min_y <= cell_y1;
+}
+
+/* Start point, unit normal and length of a wall, see CourseBlob */
+static void wall_geometry(const Line *line, float *geometry) {
+  float dx = line->x1 - line->x0, dy = line->y1 - line->y0;
+  float len = sqrtf(dx * dx + dy * dy);
+  float nx = -dy / len, ny = dx / len;
+
+  // Normal towards +x, or +y for horizontal walls
+  if (nx < 0 || (nx == 0 && ny < 0)) {
+    nx = -nx;
+    ny = -ny;
+  }
+
+  // Start at whichever end the wall runs from along (ny, -nx)
+  bool from_start = dx * ny - dy * nx >= 0;
+  geometry[0] = from_start ? line->x0 : line->x1;
+  geometry[1] = from_start ? line->y0 : line->y1;
+  geometry[2] = nx;
+  geometry[3] = ny;
+  geometry[4] = len;
+}
+
+/* Round a byte offset up to the next word */
+static int align4(int offset) { return (offset + 3) & ~3; }
+
+/* Pack a course into blob, returns its size in bytes or -1 if too big */
+int compile_course(const CourseSource *src, uint32_t *blob) {
+  static Span spans[MAX_SPANS];
+  uint8_t *base = (uint8_t *)blob;
+  CourseBlob header = {.magic = COURSE_MAGIC};
+
+  int span_count = rasterize_course(src, spans);
+  if (span_count < 0) return -1;
+
+  header.goal_x = src->goal_x;
+  header.goal_y = src->goal_y;
+  header.start_x = src->start_x;
+  header.start_y = src->start_y;
+  header.line_count = src->line_count;
+  header.span_count = span_count;
+
+  // An empty box (min > max) when there are no walls
+  header.min_x = header.min_y = 32767;
+  header.max_x = header.max_y = -32768;
+  for (int i = 0; i < src->line_count; i++) {
+    const Line *line = &src->lines[i];
+    int16_t xs[2] = {line->x0, line->x1}, ys[2] = {line->y0, line->y1};
+    for (int k = 0; k < 2; k++) {
+      if (xs[k] < header.min_x) header.min_x = xs[k];
+      if (xs[k] > header.max_x) header.max_x = xs[k];
+      if (ys[k] < header.min_y) header.min_y = ys[k];
+      if (ys[k] > header.max_y) header.max_y = ys[k];
+    }
+  }
+
+  // Count the per-cell wall copies
+  int wall_count = 0;
+  for (int cell = 0; cell < GRID_ROWS * GRID_COLS; cell++) {
+    for (int i = 0; i < src->line_count; i++) {
+      wall_count += wall_in_cell(&src->lines[i], cell % GRID_COLS,
+                                 cell / GRID_COLS);
+    }
+  }
+  header.wall_count = wall_count;
+
+  // Lay out the sections
+  int float_bytes = wall_count * sizeof(float);
+  header.cells = align4(sizeof(CourseBlob));
+  header.x0 = align4(header.cells + (GRID_ROWS * GRID_COLS + 1) * 2);
+  header.y0 = header.x0 + float_bytes;
+  header.nx = header.y0 + float_bytes;
+  header.ny = header.nx + float_bytes;
+  header.len = header.ny + float_bytes;
+  header.spans = header.len + float_bytes;
+  int size = align4(header.spans + span_count * sizeof(Span));
+  if (size > 0xFFFF) return -1;
+
+  memset(blob, 0, size);
+  uint16_t *cells = (uint16_t *)(base + header.cells);
+  float *fields[5] = {
+      (float *)(base + header.x0), (float *)(base + header.y0),
+      (float *)(base + header.nx), (float *)(base + header.ny),
+      (float *)(base + header.len),
+  };
+
+  int listed = 0;
+  for (int cell = 0; cell < GRID_ROWS * GRID_COLS; cell++) {
+    cells[cell] = listed;
+    for (int i = 0; i < src->line_count; i++) {
+      if (!wall_in_cell(&src->lines[i], cell % GRID_COLS, cell / GRID_COLS))
+        continue;
+      float geometry[5];
+      wall_geometry(&src->lines[i], geometry);
+      for (int f = 0; f < 5; f++) fields[f][listed] = geometry[f];
+      listed++;
+    }
+  }
+  cells[GRID_ROWS * GRID_COLS] = listed;
+
+  memcpy(base + header.spans, spans, span_count * sizeof(Span));
+  memcpy(base, &header, sizeof(header));
+  return size;
+}
+
+/* Read a course description, exits on errors */
+static void parse_course(const char *path, CourseSource *src) {
+  FILE *file = fopen(path, "r");
+  if (!file) {
+    perror(path);
+    exit(1);
+  }
+
+  char text[256];
+  bool has_start = false, has_goal = false;
+  memset(src, 0, sizeof(*src));
+
+  for (int line_no = 1; fgets(text, sizeof(text), file); line_no++) {
+    char *comment = strchr(text, '#');
+    if (comment) *comment = 0;
+
+    char item[16];
+    int v[4];
+    int n = sscanf(text, "%15s %d %d %d %d", item, &v[0], &v[1], &v[2], &v[3]);
+    if (n <= 0) continue;
+
+    if (!strcmp(item, "start") && n == 3) {
+      src->start_x = v[0];
+      src->start_y = v[1];
+      has_start = true;
+    } else if (!strcmp(item, "goal") && n == 3) {
+      src->goal_x = v[0];
+      src->goal_y = v[1];
+      has_goal = true;
+    } else if (!strcmp(item, "wall") && n == 5) {
+      if (v[0] == v[2] && v[1] == v[3]) {
+        fprintf(stderr, "%s:%d: wall has no length\n", path, line_no);
+        exit(1);
+      }
+      if (src->line_count == MAX_WALLS) {
+        fprintf(stderr, "%s:%d: more than %d walls\n", path, line_no,
+                MAX_WALLS);
+        exit(1);
+      }
+      Line *line = &src->lines[src->line_count++];
+      line->x0 = v[0];
+      line->y0 = v[1];
+      line->x1 = v[2];
+      line->y1 = v[3];
+    } else {
+      fprintf(stderr, "%s:%d: expected start, goal or wall\n", path, line_no);
+      exit(1);
+    }
+  }
+  fclose(file);
+
+  if (!has_start || !has_goal) {
+    fprintf(stderr, "%s: missing %s\n", path, has_start ? "goal" : "start");
+    exit(1);
+  }
+}
+
+/* Write a blob as a word array */
+void print_blob(FILE *out, const char *name, const uint32_t *blob, int size) {
+  fprintf(out, "static const uint32_t %s[] ONCHIP_RODATA = {", name);
+  for (int i = 0; i < size / 4; i++) {
+    fprintf(out, "%s%s0x%08x", i ? "," : "", i % 6 ? " " : "\n    ", blob[i]);
+  }
+  fprintf(out, "};\n");
+}
+
+#ifndef COURSE_COMPILER_NO_MAIN
+int main(int argc, char **argv) {
+  static uint32_t blob[BLOB_WORDS];
+  static CourseSource src;
+
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s course.txt... > course_pack.h\n", argv[0]);
+    return 1;
+  }
+
+  printf("/* Generated by tools/course_compiler, do not edit.\n");
+  printf(" * One packed CourseBlob per course, see map_course(). */\n");
+
+  for (int id = 0; id < argc - 1; id++) {
+    parse_course(argv[id + 1], &src);
+    int size = compile_course(&src, blob);
+    if (size < 0) {
+      fprintf(stderr, "%s: course does not fit in a blob\n", argv[id + 1]);
+      return 1;
+    }
+
+    const CourseBlob *header = (const CourseBlob *)blob;
+    fprintf(stderr, "%s: %d walls, %d spans, %d bytes\n", argv[id + 1],
+            header->line_count, header->span_count, size);
+
+    char name[32];
+    snprintf(name, sizeof(name), "course%d_blob", id);
+    printf("\n/* %s */\n", argv[id + 1]);
+    print_blob(stdout, name, blob, size);
+  }
+
+  printf("\nstatic const uint32_t *const course_blobs[] = {");
+  for (int id = 0; id < argc - 1; id++) {
+    printf("%s%scourse%d_blob", id ? "," : "", id % 4 ? " " : "\n    ", id);
+  }
+  printf("};\n");
+  return 0;
+}
+#endif
@@ -0,0 +1,339 @@
+/* Procedural course generator
+ *
+ * Build: gcc -O2 -no-pie -pthread -o course_generator \
+ *            tools/course_generator.c -lm
+ * Usage: course_generator [-t threads] [-n count] [-s seed] [-p max_par] \
+ *            [course.txt...] > course_pack.h
+ *
+ * Builds wall layouts from consecutive seeds and keeps the first count that
+ * can be holed within max_par strokes (default 9). The screen is split into
+ * ROOM_COLS x ROOM_ROWS rooms, a random self-avoiding path of rooms leads
+ * from the start to the goal and every room boundary off the path becomes a
+ * wall, with the odd stub wall added inside a path room.
+ *
+ * Each candidate is compiled into a CourseBlob and played with the game's
+ * own step_ball(): a beam search over stopping positions, keeping the
+ * BEAM_WIDTH positions furthest along the room path after each stroke.
+ * A found path is always real, so courses that pass are solvable; a few
+ * solvable ones may be rejected. Seeds are handed out to worker threads and
+ * the pack is written in seed order, so the output only depends on the
+ * options. Course descriptions given as arguments come first in the pack. */
+#define COURSE_COMPILER_NO_MAIN
+#include "course_compiler.c"
+
+#include <pthread.h>
+#include <unistd.h>
+
+#define MAX_THREADS 64
+#define MAX_SEEDS (1 << 16)  // Candidates tried before giving up
+#define ROOM_SIZE 80
+#define ROOM_COLS (SCREEN_WIDTH / ROOM_SIZE)
+#define ROOM_ROWS (SCREEN_HEIGHT / ROOM_SIZE)
+#define ROOMS (ROOM_COLS * ROOM_ROWS)
+#define MIN_PATH 3  // Rooms from start to goal
+#define MAX_PATH 7
+#define BEAM_WIDTH 16
+#define ANGLE_STEPS 63   // Arrow-key angles, 0.0 to 6.2 rad
+#define MAX_MOMENTUM 100
+#define MOMENTUM_STEP 4  // Power values tried: 4, 8, ... 100
+#define MAX_PAR 9
+
+/* A candidate and what became of it */
+typedef struct {
+  CourseSource src;
+  int par;  // Strokes needed, 0 if rejected
+} Candidate;
+
+int thread_count;
+int wanted = 8;
+unsigned int first_seed = 1;
+int max_par = MAX_PAR;
+
+Candidate *candidates;  // Indexed by seed - first_seed
+int next_seed;          // Next seed index to try
+int accepted;           // Candidates that passed so far
+pthread_mutex_t compile_lock = PTHREAD_MUTEX_INITIALIZER;  // Uses the frame
+
+/* Small deterministic generator (xorshift32) */
+unsigned int next_random(unsigned int *state) {
+  unsigned int x = *state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  return *state = x;
+}
+
+/* Walk a random self-avoiding path of rooms, returns its length */
+int walk_path(unsigned int *rng, int *path) {
+  int target = MIN_PATH + next_random(rng) % (MAX_PATH - MIN_PATH + 1);
+  bool used[ROOMS] = {false};
+  int length = 1;
+
+  path[0] = (next_random(rng) % ROOM_ROWS) * ROOM_COLS;  // Left column
+  used[path[0]] = true;
+
+  while (length < target) {
+    int room = path[length - 1];
+    int col = room % ROOM_COLS, row = room / ROOM_COLS;
+    int options[4], count = 0;
+
+    if (col > 0 && !used[room - 1]) options[count++] = room - 1;
+    if (col < ROOM_COLS - 1 && !used[room + 1]) options[count++] = room + 1;
+    if (row > 0 && !used[room - ROOM_COLS]) options[count++] = room - ROOM_COLS;
+    if (row < ROOM_ROWS - 1 && !used[room + ROOM_COLS])
+      options[count++] = room + ROOM_COLS;
+    if (count == 0) break;  // Boxed in, settle for a shorter path
+
+    room = options[next_random(rng) % count];
+    used[room] = true;
+    path[length++] = room;
+  }
+  return length;
+}
+
+/* Whether two rooms follow each other on the path */
+bool rooms_joined(const int *rank, int a, int b) {
+  return rank[a] >= 0 && rank[b] >= 0 &&
+         (rank[a] - rank[b] == 1 || rank[b] - rank[a] == 1);
+}
+
+void add_wall(CourseSource *src, int x0, int y0, int x1, int y1) {
+  Line *line = &src->lines[src->line_count++];
+  line->x0 = x0;
+  line->y0 = y0;
+  line->x1 = x1;
+  line->y1 = y1;
+}
+
+/* Build the layout for one seed. rank[] gets each room's place on the path,
+ * -1 for rooms off it. */
+void generate_course(unsigned int seed, CourseSource *src, int *rank) {
+  unsigned int rng = seed * 2654435761u | 1;
+  int path[ROOMS];
+  int length = walk_path(&rng, path);
+
+  memset(src, 0, sizeof(*src));
+  for (int room = 0; room < ROOMS; room++) rank[room] = -1;
+  for (int i = 0; i < length; i++) rank[path[i]] = i;
+
+  // Vertical boundaries, merged down each column line
+  for (int col = 1; col < ROOM_COLS; col++) {
+    int from = -1;
+    for (int row = 0; row <= ROOM_ROWS; row++) {
+      int room = row * ROOM_COLS + col;
+      bool wall = row < ROOM_ROWS && !rooms_joined(rank, room - 1, room);
+      if (wall && from < 0) from = row;
+      if (!wall && from >= 0) {
+        add_wall(src, col * ROOM_SIZE, from * ROOM_SIZE, col * ROOM_SIZE,
+                 row * ROOM_SIZE);
+        from = -1;
+      }
+    }
+  }
+
+  // Horizontal boundaries, merged along each row line
+  for (int row = 1; row < ROOM_ROWS; row++) {
+    int from = -1;
+    for (int col = 0; col <= ROOM_COLS; col++) {
+      int room = row * ROOM_COLS + col;
+      bool wall =
+          col < ROOM_COLS && !rooms_joined(rank, room - ROOM_COLS, room);
+      if (wall && from < 0) from = col;
+      if (!wall && from >= 0) {
+        add_wall(src, from * ROOM_SIZE, row * ROOM_SIZE, col * ROOM_SIZE,
+                 row * ROOM_SIZE);
+        from = -1;
+      }
+    }
+  }
+
+  // Stub walls half way into some path rooms
+  for (int i = 1; i < length; i++) {
+    if (next_random(&rng) % 3) continue;
+    int x = path[i] % ROOM_COLS * ROOM_SIZE + ROOM_SIZE / 2;
+    int y = path[i] / ROOM_COLS * ROOM_SIZE;
+    if (next_random(&rng) % 2) {
+      add_wall(src, x, y, x, y + ROOM_SIZE / 2);
+    } else {
+      add_wall(src, x, y + ROOM_SIZE / 2, x, y + ROOM_SIZE);
+    }
+  }
+
+  // Start at the left of the first room, goal near the middle of the last
+  int start = path[0], goal = path[length - 1];
+  src->start_x = start % ROOM_COLS * ROOM_SIZE + 10;
+  src->start_y = start / ROOM_COLS * ROOM_SIZE + ROOM_SIZE / 2;
+  src->goal_x = goal % ROOM_COLS * ROOM_SIZE + 20 + next_random(&rng) % 40;
+  src->goal_y = goal / ROOM_COLS * ROOM_SIZE + 20 + next_random(&rng) % 40;
+}
+
+/* Beam search for the fewest strokes to the goal, 0 if none found */
+int play_course(const Course *c, const int *rank) {
+  static __thread uint8_t seen[SCREEN_HEIGHT][SCREEN_WIDTH];
+  static __thread int64_t found[SCREEN_HEIGHT * SCREEN_WIDTH];
+  int beam[BEAM_WIDTH], beam_size = 1;
+
+  memset(seen, 0, sizeof(seen));
+  beam[0] = c->start_y * SCREEN_WIDTH + c->start_x;
+  seen[c->start_y][c->start_x] = 1;
+
+  for (int stroke = 1; stroke <= max_par; stroke++) {
+    int found_count = 0;
+
+    for (int b = 0; b < beam_size; b++) {
+      int from = beam[b];
+      for (int a = 0; a < ANGLE_STEPS; a++) {
+        for (int momentum = MOMENTUM_STEP; momentum <= MAX_MOMENTUM;
+             momentum += MOMENTUM_STEP) {
+          Ball ball = {.radius = BALL_SIZE};
+          launch_ball(&ball, from % SCREEN_WIDTH, from / SCREEN_WIDTH,
+                      momentum, a * 0.1);
+
+          int result, last_x, last_y;
+          do {
+            last_x = ball.x;
+            last_y = ball.y;
+            result = step_ball(&ball, c);
+          } while (result == BALL_ROLLING &&
+                   !(ball.dx == 0 && ball.dy == 0 && ball.x == last_x &&
+                     ball.y == last_y));
+
+          if (result == BALL_HOLED) return stroke;
+          if (ball.x < 0 || ball.x >= SCREEN_WIDTH || ball.y < 0 ||
+              ball.y >= SCREEN_HEIGHT || seen[ball.y][ball.x]) {
+            continue;
+          }
+          seen[ball.y][ball.x] = 1;
+
+          // Furthest along the path first, then closest to the goal
+          int room = ball.y / ROOM_SIZE * ROOM_COLS + ball.x / ROOM_SIZE;
+          int gx = ball.x - c->goal_x, gy = ball.y - c->goal_y;
+          int64_t key = ((int64_t)(rank[room] + 1) << 20) + (1 << 18) -
+                        (gx * gx + gy * gy);
+          found[found_count++] =
+              key << 20 | (ball.y * SCREEN_WIDTH + ball.x);
+        }
+      }
+    }
+
+    // Keep the best positions for the next stroke
+    beam_size = 0;
+    for (int k = 0; k < found_count && beam_size < BEAM_WIDTH; k++) {
+      int best = k;
+      for (int i = k + 1; i < found_count; i++) {
+        if (found[i] > found[best]) best = i;
+      }
+      int64_t swap = found[k];
+      found[k] = found[best];
+      found[best] = swap;
+      beam[beam_size++] = found[k] & 0xFFFFF;
+    }
+    if (beam_size == 0) return 0;
+  }
+  return 0;
+}
+
+/* Worker thread: try seeds until enough courses passed */
+void *worker(void *arg) {
+  static __thread uint32_t blob[BLOB_WORDS];
+  int rank[ROOMS];
+  (void)arg;
+
+  while (__atomic_load_n(&accepted, __ATOMIC_RELAXED) < wanted) {
+    int index = __atomic_fetch_add(&next_seed, 1, __ATOMIC_RELAXED);
+    if (index >= MAX_SEEDS) break;
+
+    Candidate *candidate = &candidates[index];
+    generate_course(first_seed + index, &candidate->src, rank);
+
+    pthread_mutex_lock(&compile_lock);
+    int size = compile_course(&candidate->src, blob);
+    pthread_mutex_unlock(&compile_lock);
+    if (size < 0) continue;
+
+    Course c;
+    map_course(&c, blob);
+    candidate->par = play_course(&c, rank);
+    if (candidate->par) __atomic_fetch_add(&accepted, 1, __ATOMIC_RELAXED);
+  }
+  return NULL;
+}
+
+double now_seconds() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+int main(int argc, char **argv) {
+  static uint32_t blob[BLOB_WORDS];
+  static CourseSource src;
+  pthread_t threads[MAX_THREADS];
+  int opt;
+
+  thread_count = sysconf(_SC_NPROCESSORS_ONLN);
+  while ((opt = getopt(argc, argv, "t:n:s:p:")) != -1) {
+    if (opt == 't') thread_count = atoi(optarg);
+    if (opt == 'n') wanted = atoi(optarg);
+    if (opt == 's') first_seed = strtoul(optarg, NULL, 0);
+    if (opt == 'p') max_par = atoi(optarg);
+  }
+  if (thread_count < 1) thread_count = 1;
+  if (thread_count > MAX_THREADS) thread_count = MAX_THREADS;
+
+  candidates = calloc(MAX_SEEDS, sizeof(Candidate));
+  double start = now_seconds();
+  for (int i = 0; i < thread_count; i++) {
+    pthread_create(&threads[i], NULL, worker, NULL);
+  }
+  for (int i = 0; i < thread_count; i++) pthread_join(threads[i], NULL);
+  double seconds = now_seconds() - start;
+
+  int tried = next_seed < MAX_SEEDS ? next_seed : MAX_SEEDS;
+  fprintf(stderr,
+          "%d of %d seeds solvable in %d strokes, %.2f s (%.0f seeds/s, "
+          "%d threads)\n",
+          accepted, tried, max_par, seconds, tried / seconds, thread_count);
+  if (accepted < wanted) {
+    fprintf(stderr, "not enough solvable courses\n");
+    return 1;
+  }
+
+  printf("/* Generated by tools/course_generator, do not edit.\n");
+  printf(" * One packed CourseBlob per course, see map_course(). */\n");
+
+  int id = 0;
+  for (int i = optind; i < argc; i++, id++) {
+    parse_course(argv[i], &src);
+    int size = compile_course(&src, blob);
+    if (size < 0) {
+      fprintf(stderr, "%s: course does not fit in a blob\n", argv[i]);
+      return 1;
+    }
+
+    char name[32];
+    snprintf(name, sizeof(name), "course%d_blob", id);
+    printf("\n/* %s */\n", argv[i]);
+    print_blob(stdout, name, blob, size);
+  }
+
+  // The first solvable seeds, whatever order the threads finished in
+  for (int index = 0, count = 0; count < wanted; index++) {
+    if (!candidates[index].par) continue;
+
+    char name[32];
+    snprintf(name, sizeof(name), "course%d_blob", id++);
+    printf("\n/* Seed %u, par %d */\n", first_seed + index,
+           candidates[index].par);
+    int size = compile_course(&candidates[index].src, blob);
+    print_blob(stdout, name, blob, size);
+    count++;
+  }
+
+  printf("\nstatic const uint32_t *const course_blobs[] = {");
+  for (int i = 0; i < id; i++) {
+    printf("%s%scourse%d_blob", i ? "," : "", i % 4 ? " " : "\n    ", i);
+  }
+  printf("};\n");
+  return 0;
+}
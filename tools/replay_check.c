@@ -0,0 +1,173 @@
+/* Input log round trip check
+ *
+ * Build: gcc -O2 -no-pie -o replay_check tools/replay_check.c -lm
+ * Usage: replay_check [frames] [seed]
+ *
+ * Plays the game live on the host for a number of frames (default 1200):
+ * random key presses (seed, default 1) go through the scancode queue like
+ * ps2_irq's, and SIGALRM runs timer_irq() every TICK_US, landing anywhere
+ * in a frame like the real tick. Host frames are short, so the game sees
+ * fewer ticks per frame than on the board. The input log is then replayed
+ * in a second process. The game state at the last frame must come out the
+ * same, otherwise it exits with 1. */
+#define HOST_BUILD
+#define main golf_main  // The game's main, run once in each process
+#include "../golf.c"
+#undef main
+
+#include <fcntl.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#define TICK_US 20     // Live timer_irq period
+#define LOG_SLACK 300  // Live frames recorded past the compared one
+
+int end_frame;         // Frame whose state is compared
+FILE *log_file;        // Input log of the live run
+FILE *state_file;      // State written by the current run
+uint32_t random_state;
+
+/* xorshift32, apart from the game's rand() */
+uint32_t next_random() {
+  random_state ^= random_state << 13;
+  random_state ^= random_state >> 17;
+  random_state ^= random_state << 5;
+  return random_state;
+}
+
+/* Queue bytes as ps2_irq would */
+void send_bytes(const uint8_t *bytes, int count) {
+  for (int i = 0; i < count; i++) {
+    scancode_queue[scancode_head & (SCANCODE_QUEUE_SIZE - 1)] = bytes[i];
+    scancode_head++;
+  }
+}
+
+/* Game state that input and ticks feed into, screen included */
+void write_state(FILE *file) {
+  TickState ticks;
+  read_ticks(&ticks);
+
+  uint32_t hash = 2166136261u;  // FNV-1a
+  for (int y = 0; y < SCREEN_HEIGHT; y++) {
+    for (int x = 0; x < SCREEN_WIDTH; x++) {
+      hash = (hash ^ frame[y][x]) * 16777619u;
+    }
+  }
+
+  fprintf(file,
+          "frame %d: angle %d count %d countdown %d, course %d attempts %d, "
+          "ball %d,%d moving %d,%d momentum %d active %d, player %d,%d, "
+          "screen %08x\n",
+          frame_number, ticks.angle, ticks.count, ticks.countdown, course_id,
+          attempts, balls.x[0], balls.y[0], balls.vx[0], balls.vy[0],
+          balls.momentum[0], balls.active[0], player_x, player_y, hash);
+  fflush(file);
+}
+
+void on_alarm(int signal) {
+  (void)signal;
+  timer_irq();
+}
+
+/* Live run: press keys, dump the log at the end */
+void live_frame() {
+  static const uint8_t keys[][2] = {
+      {0xE0, 0x6B},  // Left arrow
+      {0xE0, 0x74},  // Right arrow
+      {0x00, 0x29},  // Space
+      {0x00, 0x5A},  // Enter
+      {0x00, 0x33},  // H
+  };
+  static int held = -1, release = 0;
+
+  input_mode = INPUT_LIVE;  // golf_main loaded an empty log
+  if (frame_number == end_frame) write_state(state_file);
+  if (frame_number == end_frame + LOG_SLACK) {
+    fflush(stdout);
+    dup2(fileno(log_file), STDOUT_FILENO);
+    input_log_dump();
+    fflush(stdout);
+    _exit(0);
+  }
+
+  // One key at a time, held for a few frames so make and break codes
+  // reach the game in different frames
+  if (held >= 0 && frame_number >= release) {
+    uint8_t bytes[3] = {keys[held][0], 0xF0, keys[held][1]};
+    if (bytes[0]) send_bytes(bytes, 3);
+    else send_bytes(bytes + 1, 2);
+    held = -1;
+  } else if (held < 0 && next_random() % 16 == 0) {
+    held = next_random() % 5;
+    release = frame_number + 2 + next_random() % 20;
+    if (keys[held][0]) send_bytes(keys[held], 2);
+    else send_bytes(keys[held] + 1, 1);
+  }
+}
+
+void replay_frame() {
+  if (frame_number == end_frame) {
+    write_state(state_file);
+    _exit(0);
+  }
+}
+
+/* Run golf_main in a child process with stdin from input (or empty) */
+int run_game(void (*hook)(void), FILE *input, FILE *state) {
+  pid_t pid = fork();
+  if (pid == 0) {
+    int null = open("/dev/null", O_RDWR);
+    dup2(input ? fileno(input) : null, STDIN_FILENO);
+    dup2(null, STDOUT_FILENO);  // The game prints a lot
+    state_file = state;
+    host_vsync_hook = hook;
+
+    if (hook == live_frame) {
+      signal(SIGALRM, on_alarm);
+      struct itimerval tick = {{0, TICK_US}, {0, TICK_US}};
+      setitimer(ITIMER_REAL, &tick, NULL);
+    }
+    golf_main();
+    _exit(2);  // Log ran out before end_frame
+  }
+
+  int status;
+  waitpid(pid, &status, 0);
+  return WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+}
+
+int main(int argc, char **argv) {
+  end_frame = argc > 1 ? atoi(argv[1]) : 1200;
+  random_state = argc > 2 ? atoi(argv[2]) : 1;
+  if (end_frame < 2) end_frame = 2;
+  if (random_state == 0) random_state = 1;
+
+  log_file = tmpfile();
+  FILE *live = tmpfile(), *replay = tmpfile();
+
+  if (run_game(live_frame, NULL, live) != 0) {
+    fprintf(stderr, "live run failed\n");
+    return 1;
+  }
+  rewind(log_file);
+  if (run_game(replay_frame, log_file, replay) != 0) {
+    fprintf(stderr, "replay failed\n");
+    return 1;
+  }
+
+  char live_line[256] = "", replay_line[256] = "";
+  rewind(live);
+  rewind(replay);
+  fgets(live_line, sizeof(live_line), live);
+  fgets(replay_line, sizeof(replay_line), replay);
+  printf("live   %s", live_line);
+  printf("replay %s", replay_line);
+  if (strcmp(live_line, replay_line) != 0 || !live_line[0]) {
+    printf("MISMATCH\n");
+    return 1;
+  }
+  printf("replay matches\n");
+  return 0;
+}
@@ -0,0 +1,371 @@
+/* Exhaustive shot solver
+ *
+ * Build: gcc -O2 -no-pie -pthread -o shot_solver tools/shot_solver.c -lm
+ * Usage: shot_solver [-t threads] [-a angle_step] [-s max_strokes] [course...]
+ *        shot_solver -H [-t threads] > hint_table.h
+ *
+ * Simulates every (angle, momentum) shot with the game's own step_ball()
+ * and searches stroke by stroke (breadth first) from the start position,
+ * so the first stroke that reaches the goal gives the minimum-stroke path.
+ * Each stroke's shots are split into one task per (position, angle) and
+ * spread over worker threads that steal from each other when they run dry.
+ *
+ * -H writes the shot hint table used by the game instead: the best shot in
+ * arrow-key angle steps (0.1 rad) from the center of every hint cell, found
+ * by iterating strokes-to-goal over the cell graph. */
+#define HOST_BUILD
+#define GOLF_NO_MAIN
+#include "../golf.c"
+
+#include <pthread.h>
+#include <unistd.h>
+
+#define MAX_THREADS 64
+#define MAX_MOMENTUM 100
+
+/* A contiguous range of tasks owned by one worker */
+typedef struct {
+  pthread_mutex_t lock;
+  long begin, end;
+} TaskRange;
+
+/* A shot that reached the goal */
+typedef struct {
+  int from;  // Start position (y * SCREEN_WIDTH + x)
+  int angle_index, momentum;
+} Shot;
+
+typedef struct {
+  Shot *shots;
+  int count, capacity;
+} ShotList;
+
+int thread_count;
+double angle_step = 0.01;
+int angle_steps;
+int max_strokes = 9;
+
+TaskRange ranges[MAX_THREADS];
+ShotList holed[MAX_THREADS];  // Per-worker goal shots of the current stroke
+
+int *frontier;  // Positions reached with the current number of strokes
+int frontier_size;
+int *next_frontier;
+int next_size;
+pthread_mutex_t next_lock = PTHREAD_MUTEX_INITIALIZER;
+
+// Hint mode: where each (task, momentum) shot ended
+int16_t *outcomes;
+#define OUTCOME_HOLED -1    // Reached the goal
+#define OUTCOME_NOWHERE -2  // Left the screen
+
+// How each position was first reached: parent << 17 | angle << 7 | momentum,
+// plus one so that zero means unvisited
+uint64_t visited[SCREEN_HEIGHT * SCREEN_WIDTH];
+
+void shot_list_add(ShotList *list, Shot shot) {
+  if (list->count == list->capacity) {
+    list->capacity = list->capacity ? list->capacity * 2 : 256;
+    list->shots = realloc(list->shots, list->capacity * sizeof(Shot));
+  }
+  list->shots[list->count++] = shot;
+}
+
+/* Take the next task from our own range, or steal half of someone else's */
+long next_task(int self) {
+  TaskRange *own = &ranges[self];
+
+  pthread_mutex_lock(&own->lock);
+  if (own->begin < own->end) {
+    long task = own->begin++;
+    pthread_mutex_unlock(&own->lock);
+    return task;
+  }
+  pthread_mutex_unlock(&own->lock);
+
+  for (int i = 1; i < thread_count; i++) {
+    TaskRange *victim = &ranges[(self + i) % thread_count];
+
+    pthread_mutex_lock(&victim->lock);
+    long left = victim->end - victim->begin;
+    if (left <= 0) {
+      pthread_mutex_unlock(&victim->lock);
+      continue;
+    }
+    long split = victim->end - (left + 1) / 2;
+    long end = victim->end;
+    victim->end = split;
+    pthread_mutex_unlock(&victim->lock);
+
+    // Keep the first stolen task, the rest become ours
+    pthread_mutex_lock(&own->lock);
+    own->begin = split + 1;
+    own->end = end;
+    pthread_mutex_unlock(&own->lock);
+    return split;
+  }
+
+  return -1;
+}
+
+/* Simulate every momentum for one (position, angle) task */
+void run_task(int self, long task) {
+  int from = frontier[task / angle_steps];
+  int angle_index = task % angle_steps;
+
+  for (int momentum = 1; momentum <= MAX_MOMENTUM; momentum++) {
+    Ball ball = {.radius = BALL_SIZE};
+    launch_ball(&ball, from % SCREEN_WIDTH, from / SCREEN_WIDTH, momentum,
+                angle_index * angle_step);
+
+    int result, last_x, last_y;
+    do {
+      last_x = ball.x;
+      last_y = ball.y;
+      result = step_ball(&ball, course);
+
+      // A ball at rest that no wall pushes will never move again
+    } while (result == BALL_ROLLING &&
+             !(ball.dx == 0 && ball.dy == 0 && ball.x == last_x &&
+               ball.y == last_y));
+
+    bool on_screen = ball.x >= 0 && ball.x < SCREEN_WIDTH && ball.y >= 0 &&
+                     ball.y < SCREEN_HEIGHT;
+
+    if (outcomes) {
+      int16_t *outcome = &outcomes[task * MAX_MOMENTUM + momentum - 1];
+      if (result == BALL_HOLED) {
+        *outcome = OUTCOME_HOLED;
+      } else if (!on_screen) {
+        *outcome = OUTCOME_NOWHERE;
+      } else {
+        *outcome = (ball.y >> HINT_SHIFT) * HINT_COLS + (ball.x >> HINT_SHIFT);
+      }
+      continue;
+    }
+
+    if (result == BALL_HOLED) {
+      shot_list_add(&holed[self], (Shot){from, angle_index, momentum});
+      continue;
+    }
+    if (!on_screen) continue;
+
+    int to = ball.y * SCREEN_WIDTH + ball.x;
+    uint64_t expected = 0;
+    uint64_t how =
+        (((uint64_t)from << 17) | (angle_index << 7) | momentum) + 1;
+    if (__atomic_compare_exchange_n(&visited[to], &expected, how, false,
+                                    __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+      pthread_mutex_lock(&next_lock);
+      next_frontier[next_size++] = to;
+      pthread_mutex_unlock(&next_lock);
+    }
+  }
+}
+
+void *worker(void *arg) {
+  int self = (int)(intptr_t)arg;
+  long task;
+  while ((task = next_task(self)) >= 0) {
+    run_task(self, task);
+  }
+  return NULL;
+}
+
+/* Simulate every shot from every frontier position on all threads */
+void run_stroke() {
+  long tasks = (long)frontier_size * angle_steps;
+  pthread_t threads[MAX_THREADS];
+
+  for (int i = 0; i < thread_count; i++) {
+    ranges[i].begin = tasks * i / thread_count;
+    ranges[i].end = tasks * (i + 1) / thread_count;
+    holed[i].count = 0;
+  }
+  for (int i = 0; i < thread_count; i++) {
+    pthread_create(&threads[i], NULL, worker, (void *)(intptr_t)i);
+  }
+  for (int i = 0; i < thread_count; i++) {
+    pthread_join(threads[i], NULL);
+  }
+}
+
+/* Print the shots leading from the start to position `to`, in order */
+void print_path(int to, int start) {
+  if (to == start) return;
+  uint64_t how = visited[to] - 1;
+  int from = how >> 17;
+  print_path(from, start);
+  printf("  (%3d,%3d) angle %.3f momentum %3d -> (%3d,%3d)\n",
+         from % SCREEN_WIDTH, from / SCREEN_WIDTH,
+         ((how >> 7) & 0x3FF) * angle_step, (int)(how & 0x7F),
+         to % SCREEN_WIDTH, to / SCREEN_WIDTH);
+}
+
+void solve(int id) {
+  load_course(id);
+  int start = player_y * SCREEN_WIDTH + player_x;
+
+  memset(visited, 0, sizeof(visited));
+  visited[start] = 1;
+  frontier[0] = start;
+  frontier_size = 1;
+
+  printf("course %d: start (%d,%d), goal (%d,%d)\n", id, player_x, player_y,
+         course->goal_x, course->goal_y);
+
+  for (int stroke = 1; stroke <= max_strokes && frontier_size > 0; stroke++) {
+    struct timespec begin, end;
+    clock_gettime(CLOCK_MONOTONIC, &begin);
+    next_size = 0;
+    run_stroke();
+    clock_gettime(CLOCK_MONOTONIC, &end);
+    double seconds =
+        (end.tv_sec - begin.tv_sec) + (end.tv_nsec - begin.tv_nsec) * 1e-9;
+
+    int wins = 0;
+    for (int i = 0; i < thread_count; i++) wins += holed[i].count;
+
+    if (stroke == 1) {
+      printf("winning shots from the start: %d\n", wins);
+      for (int i = 0; i < thread_count; i++) {
+        for (int j = 0; j < holed[i].count; j++) {
+          printf("  angle %.3f momentum %3d\n",
+                 holed[i].shots[j].angle_index * angle_step,
+                 holed[i].shots[j].momentum);
+        }
+      }
+    }
+
+    if (wins > 0) {
+      // Any goal shot of the first successful stroke is a shortest path
+      Shot *last = NULL;
+      for (int i = 0; i < thread_count && !last; i++) {
+        if (holed[i].count) last = &holed[i].shots[0];
+      }
+      printf("minimum strokes: %d\n", stroke);
+      print_path(last->from, start);
+      printf("  (%3d,%3d) angle %.3f momentum %3d -> goal\n",
+             last->from % SCREEN_WIDTH, last->from / SCREEN_WIDTH,
+             last->angle_index * angle_step, last->momentum);
+      return;
+    }
+
+    printf("stroke %d: %ld shots, %d new positions, %.2f s\n", stroke,
+           (long)frontier_size * angle_steps * MAX_MOMENTUM, next_size,
+           seconds);
+    fflush(stdout);
+    int *swap = frontier;
+    frontier = next_frontier;
+    next_frontier = swap;
+    frontier_size = next_size;
+  }
+
+  printf("goal not reachable within %d strokes\n", max_strokes);
+}
+
+/* Find the best shot from every hint cell of a course and print its row */
+void build_hints(int id) {
+  int cells = HINT_ROWS * HINT_COLS;
+  int strokes[HINT_ROWS * HINT_COLS];
+  uint16_t hints[HINT_ROWS * HINT_COLS];
+
+  load_course(id);
+
+  // Shoot from the center of every cell
+  for (int c = 0; c < cells; c++) {
+    int x = (c % HINT_COLS << HINT_SHIFT) + (1 << HINT_SHIFT) / 2;
+    int y = (c / HINT_COLS << HINT_SHIFT) + (1 << HINT_SHIFT) / 2;
+    frontier[c] = y * SCREEN_WIDTH + x;
+    strokes[c] = HINT_MAX_STROKES + 1;
+    hints[c] = 0;
+  }
+  frontier_size = cells;
+  run_stroke();
+
+  // A cell is n strokes out if one shot lands in a cell n - 1 strokes out
+  for (int round = 0; round < HINT_MAX_STROKES; round++) {
+    for (int c = 0; c < cells; c++) {
+      for (int a = 0; a < angle_steps; a++) {
+        for (int m = 1; m <= MAX_MOMENTUM; m++) {
+          int outcome = outcomes[((long)c * angle_steps + a) * MAX_MOMENTUM +
+                                 m - 1];
+          int total;
+          if (outcome == OUTCOME_HOLED) {
+            total = 1;
+          } else if (outcome >= 0 && outcome != c) {
+            total = strokes[outcome] + 1;
+          } else {
+            continue;
+          }
+
+          if (total < strokes[c]) {
+            strokes[c] = total;
+            hints[c] = (total << 13) | (a << 7) | m;
+          }
+        }
+      }
+    }
+  }
+
+  printf("    {\n");
+  for (int row = 0; row < HINT_ROWS; row++) {
+    printf("        {");
+    for (int col = 0; col < HINT_COLS; col++) {
+      printf("0x%04x%s", hints[row * HINT_COLS + col],
+             col + 1 < HINT_COLS ? (col % 8 == 7 ? ",\n         " : ", ")
+                                 : "");
+    }
+    printf("},\n");
+  }
+  printf("    },\n");
+}
+
+/* Print hint_table.h for every course */
+void write_hint_table() {
+  angle_step = 0.1;  // One arrow key step
+  angle_steps = 63;
+  outcomes = malloc(sizeof(int16_t) * HINT_ROWS * HINT_COLS * angle_steps *
+                    MAX_MOMENTUM);
+
+  printf("/* Generated by tools/shot_solver -H, do not edit.\n");
+  printf(" * Best shot from each %dx%d pixel cell, see HINT_STROKES(). */\n",
+         1 << HINT_SHIFT, 1 << HINT_SHIFT);
+  printf("static const uint16_t hint_table[COURSE_COUNT][HINT_ROWS]"
+         "[HINT_COLS]\n    ONCHIP_RODATA = {\n");
+  for (int id = 0; id < COURSE_COUNT; id++) build_hints(id);
+  printf("};\n");
+}
+
+int main(int argc, char **argv) {
+  int opt;
+  thread_count = sysconf(_SC_NPROCESSORS_ONLN);
+
+  bool hint_mode = false;
+
+  while ((opt = getopt(argc, argv, "t:a:s:H")) != -1) {
+    if (opt == 'H') hint_mode = true;
+    if (opt == 't') thread_count = atoi(optarg);
+    if (opt == 'a') angle_step = atof(optarg);
+    if (opt == 's') max_strokes = atoi(optarg);
+  }
+  if (thread_count < 1) thread_count = 1;
+  if (thread_count > MAX_THREADS) thread_count = MAX_THREADS;
+  angle_steps = (int)(6.28 / angle_step) + 1;
+  if (angle_steps > 1024) angle_steps = 1024;  // Ten bits in visited[]
+
+  for (int i = 0; i < MAX_THREADS; i++) {
+    pthread_mutex_init(&ranges[i].lock, NULL);
+  }
+  frontier = malloc(sizeof(int) * SCREEN_WIDTH * SCREEN_HEIGHT);
+  next_frontier = malloc(sizeof(int) * SCREEN_WIDTH * SCREEN_HEIGHT);
+
+  if (hint_mode) {
+    write_hint_table();
+  } else if (optind == argc) {
+    for (int id = 0; id < COURSE_COUNT; id++) solve(id);
+  } else {
+    for (int i = optind; i < argc; i++) solve(atoi(argv[i]));
+  }
+  return 0;
+}
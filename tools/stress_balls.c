@@ -0,0 +1,89 @@
+/* Many-ball stress benchmark
+ *
+ * Build: gcc -O2 -no-pie -o stress_balls tools/stress_balls.c -lm
+ * Usage: stress_balls [balls] [frames] [course]
+ *
+ * Keeps balls (default 2000) rolling on one course for a number of frames
+ * (default 600): every ball that stops or is holed is shot again from a
+ * random spot. Walls and the goal go through step_balls(), ball-ball
+ * contacts through collide_balls(), timed separately so the sweep's share
+ * of a frame shows. */
+#define HOST_BUILD
+#define GOLF_NO_MAIN
+#include "../golf.c"
+
+#define MAX_STRESS_BALLS 65536  // Ball index must fit the sweep key
+
+double now_seconds() {
+  struct timespec now;
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return now.tv_sec + now.tv_nsec * 1e-9;
+}
+
+/* Shoot ball i from a random spot in a random direction */
+void relaunch(BallSet *set, int i) {
+  int x = BALL_SIZE + rand() % (SCREEN_WIDTH - 2 * BALL_SIZE);
+  int y = BALL_SIZE + rand() % (SCREEN_HEIGHT - 2 * BALL_SIZE);
+  launch_set_ball(set, i, x, y, 1 + rand() % 100, (rand() % 63) * 0.1);
+}
+
+int main(int argc, char **argv) {
+  int count = argc > 1 ? atoi(argv[1]) : 2000;
+  int frames = argc > 2 ? atoi(argv[2]) : 600;
+  int id = argc > 3 ? atoi(argv[3]) : 0;
+  if (count < 1) count = 1;
+  if (count > MAX_STRESS_BALLS) count = MAX_STRESS_BALLS;
+
+  BallSet set = {.count = count};
+  int *data = malloc(6 * count * sizeof(int));
+  set.x = data;
+  set.y = data + count;
+  set.vx = data + 2 * count;
+  set.vy = data + 3 * count;
+  set.momentum = data + 4 * count;
+  set.active = data + 5 * count;
+  set.sweep = malloc(count * sizeof(uint32_t));
+  uint8_t *results = malloc(count);
+
+  uint32_t *sweep = set.sweep;
+  set.sweep = NULL;  // Contacts are timed on their own below
+
+  load_course(id);
+  srand(1);
+  for (int i = 0; i < count; i++) relaunch(&set, i);
+
+  double step_seconds = 0, sweep_seconds = 0;
+  long pairs = 0, shots = count;
+
+  for (int frame = 0; frame < frames; frame++) {
+    double start = now_seconds();
+    step_balls(&set, course, results);
+    double middle = now_seconds();
+
+    set.sweep = sweep;
+    pairs += collide_balls(&set, results);
+    set.sweep = NULL;
+    double end = now_seconds();
+
+    step_seconds += middle - start;
+    sweep_seconds += end - middle;
+
+    for (int i = 0; i < count; i++) {
+      if (results[i] == BALL_STOPPED || results[i] == BALL_HOLED) {
+        relaunch(&set, i);
+        shots++;
+      }
+    }
+  }
+
+  double total = step_seconds + sweep_seconds;
+  printf("%d balls, %d frames on course %d, %ld shots\n", count, frames, id,
+         shots);
+  printf("frame   %8.3f ms (%.0f frames/s)\n", total * 1e3 / frames,
+         frames / total);
+  printf("step    %8.3f ms\n", step_seconds * 1e3 / frames);
+  printf("sweep   %8.3f ms, %.0f pair tests per frame (all pairs: %.0f)\n",
+         sweep_seconds * 1e3 / frames, (double)pairs / frames,
+         (double)count * (count - 1) / 2);
+  return 0;
+}